@@ -5,7 +5,11 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
@@ -30,6 +34,51 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Local<Context> context, Local<String> json_string);
 
+  /**
+   * For streaming newline-delimited JSON (NDJSON) into V8 in pieces. The
+   * embedder should implement a subclass of this class.
+   */
+  class V8_EXPORT StreamSource {
+   public:
+    virtual ~StreamSource() = default;
+
+    /**
+     * V8 calls this to request the next chunk of UTF-8 data from the
+     * embedder. Returns the length of the data returned. When the data ends,
+     * GetMoreData should return 0. Caller takes ownership of the data, which
+     * must have been allocated with new[].
+     *
+     * Chunk boundaries don't need to coincide with record boundaries.
+     */
+    virtual size_t GetMoreData(const uint8_t** src) = 0;
+  };
+
+  enum class CallbackResult { kException, kBreak, kContinue };
+  using RecordCallback = CallbackResult (*)(Local<Value> record,
+                                            void* callback_data);
+
+  /**
+   * Parses newline-delimited JSON (NDJSON) from |source| and calls |callback|
+   * for each record as soon as it is complete. Blank lines are skipped.
+   *
+   * In contrast to |Parse|, the full text never has to be materialized on the
+   * heap: apart from the values handed to |callback|, only the record that is
+   * currently being parsed is kept alive.
+   *
+   * The callback can stop the iteration by returning |kBreak|, and can signal
+   * that an exception was thrown by returning |kException|.
+   *
+   * \param context The context in which to parse and create the values.
+   * \param source The source of the NDJSON text.
+   * \param callback Called with each parsed record.
+   * \param callback_data Passed through to |callback|.
+   * \return Nothing if a record failed to parse or the callback returned
+   *   |kException|.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<void> ParseStream(
+      Local<Context> context, StreamSource* source, RecordCallback callback,
+      void* callback_data);
+
   /**
    * Tries to stringify the JSON-serializable object |json_object| and returns
    * it as string if successful.
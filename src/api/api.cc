@@ -3378,6 +3378,79 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+namespace {
+
+bool IsBlankJsonRecord(base::Vector<const uint8_t> record) {
+  return std::all_of(record.begin(), record.end(), [](uint8_t c) {
+    return c == ' ' || c == '\t' || c == '\r';
+  });
+}
+
+i::MaybeHandle<i::Object> ParseJsonRecord(i::Isolate* i_isolate,
+                                          base::Vector<const uint8_t> record) {
+  i::Handle<i::String> source;
+  if (!i_isolate->factory()->NewStringFromUtf8(record).ToHandle(&source)) {
+    return {};
+  }
+  source = i::String::Flatten(i_isolate, source);
+  i::Handle<i::Object> undefined = i_isolate->factory()->undefined_value();
+  return source->IsOneByteRepresentation()
+             ? i::JsonParser<uint8_t>::Parse(i_isolate, source, undefined)
+             : i::JsonParser<uint16_t>::Parse(i_isolate, source, undefined);
+}
+
+}  // namespace
+
+Maybe<void> JSON::ParseStream(Local<Context> context, StreamSource* source,
+                              RecordCallback callback, void* callback_data) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(i_isolate, context, JSON, ParseStream, i::HandleScope);
+  // Holds the start of a record that spans chunk boundaries.
+  std::vector<uint8_t> pending;
+  auto process_record =
+      [&](base::Vector<const uint8_t> record) -> CallbackResult {
+    if (IsBlankJsonRecord(record)) return CallbackResult::kContinue;
+    // Don't let the handles of earlier records accumulate.
+    i::HandleScope record_scope(i_isolate);
+    i::Handle<i::Object> value;
+    if (!ParseJsonRecord(i_isolate, record).ToHandle(&value)) {
+      has_exception = true;
+      return CallbackResult::kException;
+    }
+    return callback(Utils::ToLocal(value), callback_data);
+  };
+
+  while (true) {
+    const uint8_t* data = nullptr;
+    size_t length = source->GetMoreData(&data);
+    if (length == 0) break;
+    std::unique_ptr<const uint8_t[]> chunk(data);
+    const uint8_t* pos = data;
+    const uint8_t* end = data + length;
+    while (const uint8_t* newline = reinterpret_cast<const uint8_t*>(
+               memchr(pos, '\n', end - pos))) {
+      base::Vector<const uint8_t> record(pos, newline - pos);
+      if (!pending.empty()) {
+        pending.insert(pending.end(), pos, newline);
+        record = base::VectorOf(pending);
+      }
+      CallbackResult result = process_record(record);
+      RETURN_ON_FAILED_EXECUTION_PRIMITIVE(void);
+      if (result == CallbackResult::kException) return Nothing<void>();
+      if (result == CallbackResult::kBreak) return JustVoid();
+      pending.clear();
+      pos = newline + 1;
+    }
+    pending.insert(pending.end(), pos, end);
+  }
+
+  // The last record doesn't need to be terminated by a newline.
+  CallbackResult result = process_record(base::VectorOf(pending));
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(void);
+  if (result == CallbackResult::kException) return Nothing<void>();
+  return JustVoid();
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -323,6 +323,9 @@ bool OS::DecommitPages(void* address, size_t size) {
 // static
 bool OS::SealPages(void* address, size_t size) { return false; }
 
+// static
+bool OS::MarkPagesMergeable(void* address, size_t size) { return false; }
+
 // static
 bool OS::CanReserveAddressSpace() { return true; }
 
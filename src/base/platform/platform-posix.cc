@@ -631,6 +631,17 @@ bool OS::SealPages(void* address, size_t size) {
 #endif
 }
 
+// static
+bool OS::MarkPagesMergeable(void* address, size_t size) {
+  DCHECK_EQ(0, reinterpret_cast<uintptr_t>(address) % CommitPageSize());
+  DCHECK_EQ(0, size % CommitPageSize());
+#if V8_OS_LINUX && defined(MADV_MERGEABLE)
+  return madvise(address, size, MADV_MERGEABLE) == 0;
+#else
+  return false;
+#endif
+}
+
 // static
 bool OS::CanReserveAddressSpace() { return true; }
 
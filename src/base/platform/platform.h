@@ -358,6 +358,11 @@ class V8_BASE_EXPORT OS {
   // Make part of the process's data memory read-only.
   static void SetDataReadOnly(void* address, size_t size);
 
+  // Allows the OS to share pages of the given range with identical pages of
+  // other processes (e.g. through Linux KSM). Returns false if that isn't
+  // supported.
+  static bool MarkPagesMergeable(void* address, size_t size);
+
  private:
   // These classes use the private memory management API below.
   friend class AddressSpaceReservation;
@@ -167,8 +167,12 @@ class ConcurrentBaselineCompiler {
         DCHECK_NOT_NULL(job);
         job->Compile(&local_isolate);
         outgoing_queue_->Enqueue(std::move(job));
+        // Install every batch at the next interrupt check instead of waiting
+        // for the whole burst to be compiled, so that its functions leave the
+        // interpreter as early as possible. Pending requests are coalesced by
+        // the stack guard.
+        isolate_->stack_guard()->RequestInstallBaselineCode();
       }
-      isolate_->stack_guard()->RequestInstallBaselineCode();
     }
 
     size_t GetMaxConcurrency(size_t worker_count) const override {
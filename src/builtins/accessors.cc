@@ -12,6 +12,7 @@
 #include "src/execution/isolate-inl.h"
 #include "src/execution/messages.h"
 #include "src/heap/factory.h"
+#include "src/init/bootstrapper.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/api-callbacks.h"
 #include "src/objects/contexts.h"
@@ -227,6 +228,23 @@ Handle<AccessorInfo> Accessors::MakeArrayLengthInfo(Isolate* isolate) {
                       &ArrayLengthGetter, &ArrayLengthSetter);
 }
 
+//
+// Accessors::AtomicsObject
+//
+
+void Accessors::AtomicsObjectGetter(
+    v8::Local<v8::Name> name, const v8::PropertyCallbackInfo<v8::Value>& info) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(info.GetIsolate());
+  RCS_SCOPE(isolate, RuntimeCallCounterId::kAtomicsObjectGetter);
+  HandleScope scope(isolate);
+  // Create the object in the context of the global object holding the
+  // property, which isn't necessarily the current one.
+  auto global = Cast<JSGlobalObject>(Utils::OpenDirectHandle(*info.Holder()));
+  SaveAndSwitchContext save(isolate, global->native_context());
+  Handle<JSObject> result = CreateAtomicsObject(isolate);
+  info.GetReturnValue().Set(Utils::ToLocal(result));
+}
+
 //
 // Accessors::ModuleNamespaceEntry
 //
@@ -49,7 +49,9 @@ class JavaScriptFrame;
   V(_, wrapped_function_name, WrappedFunctionName, kHasNoSideEffect,          \
     kHasSideEffectToReceiver)
 
-#define ACCESSOR_GETTER_LIST(V) V(ModuleNamespaceEntryGetter)
+#define ACCESSOR_GETTER_LIST(V) \
+  V(AtomicsObjectGetter)        \
+  V(ModuleNamespaceEntryGetter)
 
 #define ACCESSOR_SETTER_LIST(V) \
   V(ArrayLengthSetter)          \
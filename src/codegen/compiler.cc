@@ -2418,6 +2418,10 @@ void BackgroundMergeTask::BeginMergeInBackground(
 Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
     Isolate* isolate, DirectHandle<Script> new_script) {
   DCHECK_EQ(state_, kPendingForegroundWork);
+  TimedHistogramScope timer(
+      isolate->counters()->compile_script_merge_in_foreground());
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.CompleteMergeInForeground");
 
   HandleScope handle_scope(isolate);
   DirectHandle<Script> old_script = cached_script_.ToHandleChecked();
@@ -2808,6 +2812,7 @@ bool Compiler::CollectSourcePositions(Isolate* isolate,
   flags.set_is_reparse(true);
   // Prevent parallel tasks from being spawned by this job.
   flags.set_post_parallel_compile_tasks_for_eager_toplevel(false);
+  flags.set_post_parallel_compile_tasks_for_eager_inner(false);
   flags.set_post_parallel_compile_tasks_for_lazy(false);
 
   UnoptimizedCompileState compile_state;
@@ -2862,6 +2867,43 @@ bool Compiler::CollectSourcePositions(Isolate* isolate,
   return true;
 }
 
+namespace {
+
+// Logs the lazy compilation of {shared_info}, for compile hints requested by
+// the embedder or stored in the code cache.
+void RecordLazyFunctionCompilation(
+    Isolate* isolate, DirectHandle<Script> script,
+    DirectHandle<SharedFunctionInfo> shared_info) {
+  if (!script->produce_compile_hints() && !v8_flags.code_cache_compile_hints) {
+    return;
+  }
+  Handle<ArrayList> list;
+  if (IsUndefined(script->compiled_lazy_function_positions())) {
+    constexpr int kInitialLazyFunctionPositionListSize = 100;
+    list = ArrayList::New(isolate, kInitialLazyFunctionPositionListSize);
+  } else {
+    list = handle(Cast<ArrayList>(script->compiled_lazy_function_positions()),
+                  isolate);
+    if (v8_flags.code_cache_compile_hints) {
+      // Bound the list, which then lives as long as the Script and is written
+      // into every code cache produced for it. The list produced for the
+      // embedder is left as is.
+      constexpr int kMaxLazyFunctionPositionListSize = 64 * KB;
+      if (list->length() >= kMaxLazyFunctionPositionListSize) return;
+      // Recompiles after bytecode flushing record a position again. Drop the
+      // duplicates before growing the list, which keeps this amortized cheap.
+      if (list->length() == list->capacity()) {
+        script->CompactCompiledLazyFunctionPositions();
+      }
+    }
+  }
+  list =
+      ArrayList::Add(isolate, list, Smi::FromInt(shared_info->StartPosition()));
+  script->set_compiled_lazy_function_positions(*list);
+}
+
+}  // namespace
+
 // static
 bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
                        ClearExceptionFlag flag,
@@ -2903,6 +2945,7 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
     }
     *is_compiled_scope = shared_info->is_compiled_scope(isolate);
     DCHECK(is_compiled_scope->is_compiled());
+    RecordLazyFunctionCompilation(isolate, script, shared_info);
     return true;
   }
 
@@ -2937,20 +2980,7 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
     CompileAllWithBaseline(isolate, finalize_unoptimized_compilation_data_list);
   }
 
-  if (script->produce_compile_hints()) {
-    // Log lazy funtion compilation.
-    Handle<ArrayList> list;
-    if (IsUndefined(script->compiled_lazy_function_positions())) {
-      constexpr int kInitialLazyFunctionPositionListSize = 100;
-      list = ArrayList::New(isolate, kInitialLazyFunctionPositionListSize);
-    } else {
-      list = handle(Cast<ArrayList>(script->compiled_lazy_function_positions()),
-                    isolate);
-    }
-    list = ArrayList::Add(isolate, list,
-                          Smi::FromInt(shared_info->StartPosition()));
-    script->set_compiled_lazy_function_positions(*list);
-  }
+  RecordLazyFunctionCompilation(isolate, script, shared_info);
 
   DCHECK(!isolate->has_exception());
   DCHECK(is_compiled_scope->is_compiled());
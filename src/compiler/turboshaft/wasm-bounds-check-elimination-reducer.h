@@ -0,0 +1,266 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/operation-matcher.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/phase.h"
+#include "src/compiler/turboshaft/representations.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// WasmBoundsCheckEliminationReducer removes memory bounds checks of the form
+//
+//    TrapIfNot(index <u limit, kTrapMemOutOfBounds)
+//
+// where `limit` is a constant and `index` can be proven to be statically
+// smaller than `limit`. Such checks are emitted for memory64 accesses that rely
+// on the trap handler (which only covers the 32-bit guard region), see
+// `TurboshaftGraphBuildingInterface::BoundsCheckMem`.
+//
+// The upper bound of `index` is computed with a small range analysis on the
+// input graph, which understands constants, zero-extensions, masks, shifts,
+// additions, multiplications and Phis. For loop Phis, the value flowing in
+// through the backedge is bounded by the loop condition guarding the backedge,
+// so that typical induction variables such as
+//
+//    loop: i = phi(init, i')
+//          ...  load(mem, i) ...
+//          i' = i + step
+//          br_if loop (i' <u N)
+//
+// get the range [0, max(upper_bound(init), N - 1)]. This does not hoist checks
+// out of loops: a trap is observable after the side effects of earlier
+// iterations, so moving it in front of the loop would require loop versioning.
+template <class Next>
+class WasmBoundsCheckEliminationReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(WasmBoundsCheckElimination)
+
+  V<None> REDUCE_INPUT_GRAPH(TrapIf)(V<None> ig_index, const TrapIfOp& trap) {
+    LABEL_BLOCK(no_change) {
+      return Next::ReduceInputGraphTrapIf(ig_index, trap);
+    }
+    if (!v8_flags.wasm_bounds_check_elimination) goto no_change;
+    if (trap.trap_id != TrapId::kTrapMemOutOfBounds || !trap.negated) {
+      goto no_change;
+    }
+    if (ShouldSkipOptimizationStep()) goto no_change;
+
+    const ComparisonOp* cmp =
+        __ input_graph().Get(trap.condition()).template TryCast<ComparisonOp>();
+    if (!cmp || cmp->kind != ComparisonOp::Kind::kUnsignedLessThan) {
+      goto no_change;
+    }
+    WordRepresentation rep;
+    if (!ToWordRepresentation(cmp->rep, &rep)) goto no_change;
+    uint64_t limit;
+    if (!matcher_.MatchIntegralWordConstant(cmp->right(), rep, &limit)) {
+      goto no_change;
+    }
+    remaining_visits_ = kMaxVisits;
+    uint64_t index_upper_bound = UpperBound(cmp->left(), rep, 0);
+    if (index_upper_bound >= limit) goto no_change;
+
+    if (V8_UNLIKELY(v8_flags.trace_wasm_bounds_check_elimination)) {
+      PrintF("[bounds check elimination] removed check #%u (index <= %" PRIu64
+             " < %" PRIu64 ")\n",
+             ig_index.id(), index_upper_bound, limit);
+    }
+    // The check always succeeds, so we can just drop it.
+    return V<None>::Invalid();
+  }
+
+ private:
+  // Limits the recursion of {UpperBound}, which also guarantees termination
+  // when visiting loop Phis whose backedge input isn't guarded.
+  static constexpr int kMaxDepth = 8;
+  // Limits the total number of operations {UpperBound} visits per bounds
+  // check. Without it, operations with several inputs would make the cost
+  // exponential in {kMaxDepth}.
+  static constexpr int kMaxVisits = 64;
+  // Number of Goto-terminated blocks we look through when searching for the
+  // Branch guarding a loop backedge.
+  static constexpr int kMaxBackedgeGuardDistance = 4;
+
+  static bool ToWordRepresentation(RegisterRepresentation rep,
+                                   WordRepresentation* word_rep) {
+    if (rep == RegisterRepresentation::Word32()) {
+      *word_rep = WordRepresentation::Word32();
+      return true;
+    }
+    if (rep == RegisterRepresentation::Word64()) {
+      *word_rep = WordRepresentation::Word64();
+      return true;
+    }
+    return false;
+  }
+
+  // Returns an upper bound (as an unsigned value) of the input graph
+  // operation {idx} of representation {rep}.
+  uint64_t UpperBound(OpIndex idx, WordRepresentation rep, int depth) {
+    const uint64_t unknown = rep.MaxUnsignedValue();
+    if (depth >= kMaxDepth || remaining_visits_ == 0) return unknown;
+    --remaining_visits_;
+    const Graph& graph = __ input_graph();
+    const Operation& op = graph.Get(idx);
+
+    if (uint64_t constant;
+        matcher_.MatchIntegralWordConstant(idx, rep, &constant)) {
+      return constant;
+    }
+    if (const ChangeOp* change = op.TryCast<ChangeOp>()) {
+      if (change->kind == ChangeOp::Kind::kZeroExtend &&
+          change->from == RegisterRepresentation::Word32()) {
+        return std::min(unknown, UpperBound(change->input(),
+                                            WordRepresentation::Word32(),
+                                            depth + 1));
+      }
+      return unknown;
+    }
+    if (const WordBinopOp* binop = op.TryCast<WordBinopOp>()) {
+      WordRepresentation binop_rep = binop->rep;
+      uint64_t max = std::min(unknown, binop_rep.MaxUnsignedValue());
+      switch (binop->kind) {
+        case WordBinopOp::Kind::kBitwiseAnd:
+          return std::min(UpperBound(binop->left(), binop_rep, depth + 1),
+                          UpperBound(binop->right(), binop_rep, depth + 1));
+        case WordBinopOp::Kind::kAdd: {
+          uint64_t left = UpperBound(binop->left(), binop_rep, depth + 1);
+          uint64_t right = UpperBound(binop->right(), binop_rep, depth + 1);
+          if (left > max - right) return unknown;
+          return left + right;
+        }
+        case WordBinopOp::Kind::kMul: {
+          uint64_t left = UpperBound(binop->left(), binop_rep, depth + 1);
+          uint64_t right = UpperBound(binop->right(), binop_rep, depth + 1);
+          if (left != 0 && right > max / left) return unknown;
+          return left * right;
+        }
+        case WordBinopOp::Kind::kUnsignedDiv:
+          return UpperBound(binop->left(), binop_rep, depth + 1);
+        case WordBinopOp::Kind::kUnsignedMod: {
+          uint64_t right = UpperBound(binop->right(), binop_rep, depth + 1);
+          if (right == 0) return unknown;
+          return std::min(UpperBound(binop->left(), binop_rep, depth + 1),
+                          right - 1);
+        }
+        default:
+          return unknown;
+      }
+    }
+    if (const ShiftOp* shift = op.TryCast<ShiftOp>()) {
+      int amount;
+      OpIndex input;
+      if (shift->kind == ShiftOp::Kind::kShiftRightLogical &&
+          matcher_.MatchConstantRightShift(idx, &input, shift->rep, &amount)) {
+        return UpperBound(input, shift->rep, depth + 1) >> amount;
+      }
+      if (matcher_.MatchConstantLeftShift(idx, &input, shift->rep, &amount)) {
+        uint64_t value = UpperBound(input, shift->rep, depth + 1);
+        if (value > (shift->rep.MaxUnsignedValue() >> amount)) return unknown;
+        return value << amount;
+      }
+      return unknown;
+    }
+    if (const PhiOp* phi = op.TryCast<PhiOp>()) {
+      WordRepresentation phi_rep;
+      if (!ToWordRepresentation(phi->rep, &phi_rep) || phi_rep != rep) {
+        return unknown;
+      }
+      const Block& block = graph.Get(graph.BlockOf(idx));
+      uint64_t result = 0;
+      for (size_t i = 0; i < phi->input_count; ++i) {
+        OpIndex input = phi->input(i);
+        uint64_t input_bound;
+        if (block.IsLoop() && i == PhiOp::kLoopPhiBackEdgeIndex &&
+            BackedgeUpperBound(block, input, rep, &input_bound)) {
+          // {input_bound} was derived from the loop condition.
+        } else {
+          input_bound = UpperBound(input, rep, depth + 1);
+        }
+        result = std::max(result, input_bound);
+        if (result == unknown) break;
+      }
+      return result;
+    }
+    return unknown;
+  }
+
+  // Tries to bound {value}, the backedge input of a Phi of the loop {header},
+  // by looking for a Branch on `value <u N` (or an equivalent comparison) that
+  // has to be taken in order to reach the backedge.
+  bool BackedgeUpperBound(const Block& header, OpIndex value,
+                          WordRepresentation rep, uint64_t* result) {
+    const Graph& graph = __ input_graph();
+    const Block* block = header.LastPredecessor();
+    for (int i = 0; i < kMaxBackedgeGuardDistance; ++i) {
+      if (block->PredecessorCount() != 1) return false;
+      const Block* pred = block->LastPredecessor();
+      const Operation& last = pred->LastOperation(graph);
+      if (last.Is<GotoOp>()) {
+        block = pred;
+        continue;
+      }
+      const BranchOp* branch = last.TryCast<BranchOp>();
+      if (!branch || branch->if_true == branch->if_false) return false;
+      const bool condition_holds = branch->if_true == block;
+      const ComparisonOp* cmp =
+          graph.Get(branch->condition()).TryCast<ComparisonOp>();
+      WordRepresentation cmp_rep;
+      if (!cmp || !ToWordRepresentation(cmp->rep, &cmp_rep) || cmp_rep != rep) {
+        return false;
+      }
+      const bool or_equal =
+          cmp->kind == ComparisonOp::Kind::kUnsignedLessThanOrEqual;
+      if (!or_equal && cmp->kind != ComparisonOp::Kind::kUnsignedLessThan) {
+        return false;
+      }
+      uint64_t constant;
+      if (condition_holds && cmp->left() == value &&
+          matcher_.MatchIntegralWordConstant(cmp->right(), rep, &constant)) {
+        // `value < N` or `value <= N`.
+        if (or_equal) {
+          *result = constant;
+          return true;
+        }
+        if (constant == 0) return false;
+        *result = constant - 1;
+        return true;
+      }
+      if (!condition_holds && cmp->right() == value &&
+          matcher_.MatchIntegralWordConstant(cmp->left(), rep, &constant)) {
+        // `!(N < value)` or `!(N <= value)`.
+        if (!or_equal) {
+          *result = constant;
+          return true;
+        }
+        if (constant == 0) return false;
+        *result = constant - 1;
+        return true;
+      }
+      return false;
+    }
+    return false;
+  }
+
+  const OperationMatcher matcher_{__ input_graph()};
+  int remaining_visits_ = 0;
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
@@ -10,6 +10,7 @@
 #include "src/compiler/turboshaft/phase.h"
 #include "src/compiler/turboshaft/required-optimization-reducer.h"
 #include "src/compiler/turboshaft/variable-reducer.h"
+#include "src/compiler/turboshaft/wasm-bounds-check-elimination-reducer.h"
 #include "src/compiler/turboshaft/wasm-lowering-reducer.h"
 #include "src/numbers/conversions-inl.h"
 
@@ -20,8 +21,8 @@ void WasmLoweringPhase::Run(PipelineData* data, Zone* temp_zone) {
                               v8_flags.turboshaft_trace_reduction);
   // Also run the MachineOptimizationReducer as it can help the late load
   // elimination that follows this phase eliminate more loads.
-  CopyingPhase<WasmLoweringReducer, MachineOptimizationReducer>::Run(data,
-                                                                     temp_zone);
+  CopyingPhase<WasmLoweringReducer, WasmBoundsCheckEliminationReducer,
+               MachineOptimizationReducer>::Run(data, temp_zone);
 }
 
 }  // namespace v8::internal::compiler::turboshaft
@@ -2120,6 +2120,7 @@ void IrRegExpData::IrRegExpDataVerify(Isolate* isolate) {
   CHECK(IsSmi(TaggedField<Object>::load(*this, kCaptureCountOffset)));
   CHECK(IsSmi(TaggedField<Object>::load(*this, kTicksUntilTierUpOffset)));
   CHECK(IsSmi(TaggedField<Object>::load(*this, kBacktrackLimitOffset)));
+  CHECK(required_literal() == Smi::zero() || IsString(required_literal()));
 
   switch (type_tag()) {
     case RegExpData::Type::EXPERIMENTAL: {
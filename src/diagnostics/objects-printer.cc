@@ -926,6 +926,7 @@ void IrRegExpData::IrRegExpDataPrint(std::ostream& os) {
   os << "\n - capture_count: " << max_register_count();
   os << "\n - ticks_until_tier_up: " << max_register_count();
   os << "\n - backtrack_limit: " << max_register_count();
+  os << "\n - required_literal: " << Brief(required_literal());
   os << "\n";
 }
 
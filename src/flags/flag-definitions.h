@@ -1702,6 +1702,10 @@ DEFINE_BOOL(
     "enforce explicit bounds check even if the trap handler is available")
 // "no bounds checks" implies "no enforced bounds checks".
 DEFINE_NEG_NEG_IMPLICATION(wasm_bounds_checks, wasm_enforce_bounds_checks)
+DEFINE_BOOL(wasm_bounds_check_elimination, true,
+            "remove memory64 bounds checks that are statically in bounds")
+DEFINE_BOOL(trace_wasm_bounds_check_elimination, false,
+            "trace removal of statically in-bounds memory64 bounds checks")
 DEFINE_BOOL(wasm_math_intrinsics, true,
             "intrinsify some Math imports into wasm")
 
@@ -2074,6 +2078,9 @@ DEFINE_BOOL_READONLY(verify_heap, false,
 #endif
 DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
+DEFINE_BOOL(mergeable_read_only_space, false,
+            "let the OS share identical read-only space pages between "
+            "processes (Linux KSM)")
 DEFINE_BOOL(memory_reducer_favors_memory, true,
             "memory reducer runs GC with ReduceMemoryFootprint flag")
 DEFINE_BOOL(memory_reducer_for_small_heaps, true,
@@ -2415,10 +2422,20 @@ DEFINE_EXPERIMENTAL_FEATURE(
     "spawn parallel compile tasks for eagerly compiled, top-level functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_eager_toplevel,
                    lazy_compile_dispatcher)
+DEFINE_EXPERIMENTAL_FEATURE(
+    parallel_compile_tasks_for_eager_inner,
+    "spawn parallel compile tasks for eagerly compiled inner functions")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_eager_inner,
+                   lazy_compile_dispatcher)
 DEFINE_EXPERIMENTAL_FEATURE(
     parallel_compile_tasks_for_lazy,
     "spawn parallel compile tasks for all lazily compiled functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
+DEFINE_EXPERIMENTAL_FEATURE(
+    code_cache_compile_hints,
+    "record lazily compiled functions in the code cache and compile them on "
+    "background threads when the code cache is consumed")
+DEFINE_IMPLICATION(code_cache_compile_hints, lazy_compile_dispatcher)
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
@@ -2655,6 +2672,8 @@ DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(trace_deserialization, false, "Trace the snapshot deserialization.")
+DEFINE_BOOL(concurrent_snapshot_decompression, true,
+            "Decompress the chunks of compressed snapshots on worker threads.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
 // Regexp
@@ -2675,6 +2694,9 @@ DEFINE_INT(regexp_tier_up_ticks, 1,
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(regexp_results_cache, true, "enable the regexp results cache")
+DEFINE_BOOL(regexp_literal_prefilter, true,
+            "reject subjects that don't contain a literal required by the "
+            "regexp before running irregexp")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
             "trace regexp bytecode peephole optimization")
 DEFINE_BOOL(trace_regexp_bytecodes, false, "trace regexp bytecode execution")
@@ -2699,6 +2721,14 @@ DEFINE_UINT64(experimental_regexp_engine_capture_group_opt_max_memory_usage,
               "maximum memory usage in MB allowed for experimental engine")
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
+DEFINE_BOOL(experimental_regexp_engine_dfa, true,
+            "skip inputs without a match using a lazily built DFA in the "
+            "experimental regexp engine")
+DEFINE_BOOL(experimental_regexp_engine_for_unsafe_patterns, false,
+            "run regexps with nested unbounded quantifiers on the "
+            "experimental engine where possible")
+DEFINE_IMPLICATION(experimental_regexp_engine_for_unsafe_patterns,
+                   enable_experimental_regexp_engine)
 
 DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, false,
             "fall back to a breadth-first regexp engine on excessive "
@@ -3214,7 +3244,9 @@ DEFINE_NEG_IMPLICATION(predictable, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(predictable, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(predictable, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_toplevel)
+DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_inner)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(predictable, code_cache_compile_hints)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(predictable, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(predictable, maglev_build_code_on_background)
@@ -3248,7 +3280,9 @@ DEFINE_NEG_IMPLICATION(single_threaded, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_eager_inner)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded, code_cache_compile_hints)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
@@ -4194,6 +4194,7 @@ Handle<RegExpData> Factory::NewIrRegExpData(DirectHandle<String> source,
                                 : JSRegExp::kUninitializedValue;
   instance->set_ticks_until_tier_up(ticks_until_tier_up);
   instance->set_backtrack_limit(backtrack_limit);
+  instance->set_required_literal(Smi::zero());
   Tagged<RegExpDataWrapper> raw_wrapper = *wrapper;
   instance->set_wrapper(raw_wrapper);
   raw_wrapper->set_data(instance);
@@ -4228,6 +4229,7 @@ Handle<RegExpData> Factory::NewExperimentalRegExpData(
   instance->set_capture_count(capture_count);
   instance->set_ticks_until_tier_up(JSRegExp::kUninitializedValue);
   instance->set_backtrack_limit(JSRegExp::kUninitializedValue);
+  instance->set_required_literal(Smi::zero());
   Tagged<RegExpDataWrapper> raw_wrapper = *wrapper;
   instance->set_wrapper(raw_wrapper);
   raw_wrapper->set_data(instance);
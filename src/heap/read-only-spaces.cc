@@ -9,6 +9,7 @@
 #include "include/v8-internal.h"
 #include "include/v8-platform.h"
 #include "src/base/logging.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/common/ptr-compr-inl.h"
 #include "src/execution/isolate.h"
@@ -221,6 +222,16 @@ void ReadOnlySpace::Seal(SealMode ro_mode) {
   }
 
   SetPermissionsForPages(memory_allocator, PageAllocator::kRead);
+
+  if (v8_flags.mergeable_read_only_space) {
+    // With static roots, the read-only space has the same layout and mostly
+    // the same contents in every process, so most of its pages can be shared
+    // once the OS merges them.
+    for (ReadOnlyPageMetadata* p : pages_) {
+      USE(base::OS::MarkPagesMergeable(
+          reinterpret_cast<void*>(p->ChunkAddress()), p->size()));
+    }
+  }
 }
 
 void ReadOnlySpace::Unseal() {
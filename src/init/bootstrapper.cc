@@ -2254,6 +2254,92 @@ void LazyInitializeGlobalThisTemporal(
 
 }  // namespace
 
+// Creates the Atomics object of the current native context, see the lazy
+// accessor installed in Genesis::InitializeGlobal.
+Handle<JSObject> CreateAtomicsObject(Isolate* isolate) {
+  Handle<JSObject> atomics_object = isolate->factory()->NewJSObject(
+      isolate->object_function(), AllocationType::kOld);
+  InstallToStringTag(isolate, atomics_object, "Atomics");
+
+  SimpleInstallFunction(isolate, atomics_object, "load", Builtin::kAtomicsLoad,
+                        2, kAdapt);
+  SimpleInstallFunction(isolate, atomics_object, "store",
+                        Builtin::kAtomicsStore, 3, kAdapt);
+  SimpleInstallFunction(isolate, atomics_object, "add", Builtin::kAtomicsAdd, 3,
+                        kAdapt);
+  SimpleInstallFunction(isolate, atomics_object, "sub", Builtin::kAtomicsSub, 3,
+                        kAdapt);
+  SimpleInstallFunction(isolate, atomics_object, "and", Builtin::kAtomicsAnd, 3,
+                        kAdapt);
+  SimpleInstallFunction(isolate, atomics_object, "or", Builtin::kAtomicsOr, 3,
+                        kAdapt);
+  SimpleInstallFunction(isolate, atomics_object, "xor", Builtin::kAtomicsXor, 3,
+                        kAdapt);
+  SimpleInstallFunction(isolate, atomics_object, "exchange",
+                        Builtin::kAtomicsExchange, 3, kAdapt);
+  SimpleInstallFunction(isolate, atomics_object, "compareExchange",
+                        Builtin::kAtomicsCompareExchange, 4, kAdapt);
+  SimpleInstallFunction(isolate, atomics_object, "isLockFree",
+                        Builtin::kAtomicsIsLockFree, 1, kAdapt);
+  SimpleInstallFunction(isolate, atomics_object, "wait", Builtin::kAtomicsWait,
+                        4, kAdapt);
+  SimpleInstallFunction(isolate, atomics_object, "waitAsync",
+                        Builtin::kAtomicsWaitAsync, 4, kAdapt);
+  SimpleInstallFunction(isolate, atomics_object, "notify",
+                        Builtin::kAtomicsNotify, 3, kAdapt);
+
+  // Experimental features are installed here rather than in the respective
+  // Genesis::InitializeGlobal_* functions, which would have to create the
+  // object.
+  if (v8_flags.js_atomics_pause) {
+    InstallFunctionWithBuiltinId(isolate, atomics_object, "pause",
+                                 Builtin::kAtomicsPause, 0, kDontAdapt);
+  }
+  if (v8_flags.harmony_struct) {
+    ReadOnlyRoots roots(isolate);
+    {  // Atomics.Mutex
+      Handle<String> mutex_str =
+          isolate->factory()->InternalizeUtf8String("Mutex");
+      Handle<JSFunction> mutex_fun = CreateSharedObjectConstructor(
+          isolate, mutex_str, roots.js_atomics_mutex_map_handle(),
+          Builtin::kAtomicsMutexConstructor, 0, kAdapt);
+      JSObject::AddProperty(isolate, atomics_object, mutex_str, mutex_fun,
+                            DONT_ENUM);
+
+      SimpleInstallFunction(isolate, mutex_fun, "lock",
+                            Builtin::kAtomicsMutexLock, 2, kAdapt);
+      SimpleInstallFunction(isolate, mutex_fun, "lockWithTimeout",
+                            Builtin::kAtomicsMutexLockWithTimeout, 3, kAdapt);
+      SimpleInstallFunction(isolate, mutex_fun, "tryLock",
+                            Builtin::kAtomicsMutexTryLock, 2, kAdapt);
+      SimpleInstallFunction(isolate, mutex_fun, "isMutex",
+                            Builtin::kAtomicsMutexIsMutex, 1, kAdapt);
+      SimpleInstallFunction(isolate, mutex_fun, "lockAsync",
+                            Builtin::kAtomicsMutexLockAsync, 2, kAdapt);
+    }
+
+    {  // Atomics.Condition
+      Handle<String> condition_str =
+          isolate->factory()->InternalizeUtf8String("Condition");
+      Handle<JSFunction> condition_fun = CreateSharedObjectConstructor(
+          isolate, condition_str, roots.js_atomics_condition_map_handle(),
+          Builtin::kAtomicsConditionConstructor, 0, kAdapt);
+      JSObject::AddProperty(isolate, atomics_object, condition_str,
+                            condition_fun, DONT_ENUM);
+
+      SimpleInstallFunction(isolate, condition_fun, "wait",
+                            Builtin::kAtomicsConditionWait, 2, kDontAdapt);
+      SimpleInstallFunction(isolate, condition_fun, "notify",
+                            Builtin::kAtomicsConditionNotify, 2, kDontAdapt);
+      SimpleInstallFunction(isolate, condition_fun, "isCondition",
+                            Builtin::kAtomicsConditionIsCondition, 1, kAdapt);
+      SimpleInstallFunction(isolate, condition_fun, "waitAsync",
+                            Builtin::kAtomicsConditionWaitAsync, 2, kDontAdapt);
+    }
+  }
+  return atomics_object;
+}
+
 // This is only called if we are not using snapshots.  The equivalent
 // work in the snapshot case is done in HookUpGlobalObject.
 void Genesis::InitializeGlobal(Handle<JSGlobalObject> global_object,
@@ -4269,38 +4355,13 @@ void Genesis::InitializeGlobal(Handle<JSGlobalObject> global_object,
   }
 
   {  // -- A t o m i c s
-    Handle<JSObject> atomics_object =
-        factory->NewJSObject(isolate_->object_function(), AllocationType::kOld);
-    JSObject::AddProperty(isolate_, global, "Atomics", atomics_object,
-                          DONT_ENUM);
-    InstallToStringTag(isolate_, atomics_object, "Atomics");
-
-    SimpleInstallFunction(isolate_, atomics_object, "load",
-                          Builtin::kAtomicsLoad, 2, kAdapt);
-    SimpleInstallFunction(isolate_, atomics_object, "store",
-                          Builtin::kAtomicsStore, 3, kAdapt);
-    SimpleInstallFunction(isolate_, atomics_object, "add", Builtin::kAtomicsAdd,
-                          3, kAdapt);
-    SimpleInstallFunction(isolate_, atomics_object, "sub", Builtin::kAtomicsSub,
-                          3, kAdapt);
-    SimpleInstallFunction(isolate_, atomics_object, "and", Builtin::kAtomicsAnd,
-                          3, kAdapt);
-    SimpleInstallFunction(isolate_, atomics_object, "or", Builtin::kAtomicsOr,
-                          3, kAdapt);
-    SimpleInstallFunction(isolate_, atomics_object, "xor", Builtin::kAtomicsXor,
-                          3, kAdapt);
-    SimpleInstallFunction(isolate_, atomics_object, "exchange",
-                          Builtin::kAtomicsExchange, 3, kAdapt);
-    SimpleInstallFunction(isolate_, atomics_object, "compareExchange",
-                          Builtin::kAtomicsCompareExchange, 4, kAdapt);
-    SimpleInstallFunction(isolate_, atomics_object, "isLockFree",
-                          Builtin::kAtomicsIsLockFree, 1, kAdapt);
-    SimpleInstallFunction(isolate_, atomics_object, "wait",
-                          Builtin::kAtomicsWait, 4, kAdapt);
-    SimpleInstallFunction(isolate(), atomics_object, "waitAsync",
-                          Builtin::kAtomicsWaitAsync, 4, kAdapt);
-    SimpleInstallFunction(isolate_, atomics_object, "notify",
-                          Builtin::kAtomicsNotify, 3, kAdapt);
+    // The Atomics object is rarely used, so it is only created upon first
+    // access. This keeps it out of the context snapshot.
+    Handle<String> name = factory->InternalizeUtf8String("Atomics");
+    Handle<AccessorInfo> accessor = Accessors::MakeAccessor(
+        isolate(), name, Accessors::AtomicsObjectGetter, nullptr);
+    accessor->set_replace_on_access(true);
+    JSObject::SetAccessor(global, name, accessor, DONT_ENUM).Check();
   }
 
   {  // -- T y p e d A r r a y
@@ -5494,6 +5555,8 @@ EMPTY_INITIALIZE_GLOBAL_FOR_FEATURE(harmony_import_attributes)
 EMPTY_INITIALIZE_GLOBAL_FOR_FEATURE(js_regexp_modifiers)
 EMPTY_INITIALIZE_GLOBAL_FOR_FEATURE(js_regexp_duplicate_named_groups)
 EMPTY_INITIALIZE_GLOBAL_FOR_FEATURE(js_decorators)
+// Installed by CreateAtomicsObject.
+EMPTY_INITIALIZE_GLOBAL_FOR_FEATURE(js_atomics_pause)
 
 #ifdef V8_INTL_SUPPORT
 EMPTY_INITIALIZE_GLOBAL_FOR_FEATURE(harmony_intl_best_fit_matcher)
@@ -5604,15 +5667,6 @@ void Genesis::InitializeGlobal_harmony_iterator_helpers() {
 #undef ITERATOR_HELPERS
 }
 
-void Genesis::InitializeGlobal_js_atomics_pause() {
-  if (!v8_flags.js_atomics_pause) return;
-  Handle<JSGlobalObject> global(native_context()->global_object(), isolate());
-  Handle<JSObject> atomics_object = Cast<JSObject>(
-      JSReceiver::GetProperty(isolate(), global, "Atomics").ToHandleChecked());
-  InstallFunctionWithBuiltinId(isolate(), atomics_object, "pause",
-                               Builtin::kAtomicsPause, 0, kDontAdapt);
-}
-
 void Genesis::InitializeGlobal_js_promise_try() {
   if (!v8_flags.js_promise_try) return;
   Handle<JSFunction> promise_fun =
@@ -5722,8 +5776,6 @@ void Genesis::InitializeGlobal_harmony_struct() {
 
   ReadOnlyRoots roots(isolate());
   Handle<JSGlobalObject> global(native_context()->global_object(), isolate());
-  Handle<JSObject> atomics_object = Cast<JSObject>(
-      JSReceiver::GetProperty(isolate(), global, "Atomics").ToHandleChecked());
 
   {
     // Install shared objects @@hasInstance in the native context.
@@ -5764,46 +5816,6 @@ void Genesis::InitializeGlobal_harmony_struct() {
     SimpleInstallFunction(isolate(), shared_array_fun, "isSharedArray",
                           Builtin::kSharedArrayIsSharedArray, 1, kAdapt);
   }
-
-  {  // Atomics.Mutex
-    Handle<String> mutex_str =
-        isolate()->factory()->InternalizeUtf8String("Mutex");
-    Handle<JSFunction> mutex_fun = CreateSharedObjectConstructor(
-        isolate(), mutex_str, roots.js_atomics_mutex_map_handle(),
-        Builtin::kAtomicsMutexConstructor, 0, kAdapt);
-    JSObject::AddProperty(isolate(), atomics_object, mutex_str, mutex_fun,
-                          DONT_ENUM);
-
-    SimpleInstallFunction(isolate(), mutex_fun, "lock",
-                          Builtin::kAtomicsMutexLock, 2, kAdapt);
-    SimpleInstallFunction(isolate(), mutex_fun, "lockWithTimeout",
-                          Builtin::kAtomicsMutexLockWithTimeout, 3, kAdapt);
-    SimpleInstallFunction(isolate(), mutex_fun, "tryLock",
-                          Builtin::kAtomicsMutexTryLock, 2, kAdapt);
-    SimpleInstallFunction(isolate(), mutex_fun, "isMutex",
-                          Builtin::kAtomicsMutexIsMutex, 1, kAdapt);
-    SimpleInstallFunction(isolate(), mutex_fun, "lockAsync",
-                          Builtin::kAtomicsMutexLockAsync, 2, kAdapt);
-  }
-
-  {  // Atomics.Condition
-    Handle<String> condition_str =
-        isolate()->factory()->InternalizeUtf8String("Condition");
-    Handle<JSFunction> condition_fun = CreateSharedObjectConstructor(
-        isolate(), condition_str, roots.js_atomics_condition_map_handle(),
-        Builtin::kAtomicsConditionConstructor, 0, kAdapt);
-    JSObject::AddProperty(isolate(), atomics_object, condition_str,
-                          condition_fun, DONT_ENUM);
-
-    SimpleInstallFunction(isolate(), condition_fun, "wait",
-                          Builtin::kAtomicsConditionWait, 2, kDontAdapt);
-    SimpleInstallFunction(isolate(), condition_fun, "notify",
-                          Builtin::kAtomicsConditionNotify, 2, kDontAdapt);
-    SimpleInstallFunction(isolate(), condition_fun, "isCondition",
-                          Builtin::kAtomicsConditionIsCondition, 1, kAdapt);
-    SimpleInstallFunction(isolate(), condition_fun, "waitAsync",
-                          Builtin::kAtomicsConditionWaitAsync, 2, kDontAdapt);
-  }
 }
 
 void Genesis::InitializeGlobal_sharedarraybuffer() {
@@ -134,6 +134,8 @@ V8_NOINLINE Handle<JSFunction> SimpleInstallFunction(
     Isolate* isolate, Handle<JSObject> base, const char* name, Builtin call,
     int len, AdaptArguments adapt, PropertyAttributes attrs = DONT_ENUM);
 
+Handle<JSObject> CreateAtomicsObject(Isolate* isolate);
+
 }  // namespace internal
 }  // namespace v8
 
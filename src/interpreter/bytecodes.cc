@@ -301,6 +301,65 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kCreateArrayLiteral:
       case Bytecode::kThrowReferenceErrorIfHole:
       case Bytecode::kGetTemplateObject:
+#ifdef V8_JITLESS
+      // Without the compiler tiers all code runs in the interpreter, which
+      // makes saving the dispatch worth the larger handlers for these as well.
+      case Bytecode::kLdaTrue:
+      case Bytecode::kLdaFalse:
+      case Bytecode::kLdaModuleVariable:
+      case Bytecode::kGetNamedPropertyFromSuper:
+      case Bytecode::kDiv:
+      case Bytecode::kMod:
+      case Bytecode::kExp:
+      case Bytecode::kBitwiseOr:
+      case Bytecode::kBitwiseXor:
+      case Bytecode::kBitwiseAnd:
+      case Bytecode::kShiftLeft:
+      case Bytecode::kShiftRight:
+      case Bytecode::kShiftRightLogical:
+      case Bytecode::kMulSmi:
+      case Bytecode::kDivSmi:
+      case Bytecode::kModSmi:
+      case Bytecode::kBitwiseOrSmi:
+      case Bytecode::kBitwiseAndSmi:
+      case Bytecode::kShiftLeftSmi:
+      case Bytecode::kShiftRightSmi:
+      case Bytecode::kNegate:
+      case Bytecode::kToNumeric:
+      case Bytecode::kToNumber:
+      case Bytecode::kToString:
+      case Bytecode::kCallRuntime:
+      case Bytecode::kCallJSRuntime:
+      case Bytecode::kCreateClosure:
+      case Bytecode::kCreateEmptyObjectLiteral:
+      case Bytecode::kCreateEmptyArrayLiteral:
+      case Bytecode::kCreateRegExpLiteral:
+      case Bytecode::kCloneObject:
+#endif  // V8_JITLESS
+        return true;
+      default:
+        return false;
+    }
+  }
+  return false;
+}
+
+// static
+bool Bytecodes::IsJumpIfBooleanLookahead(Bytecode bytecode,
+                                         OperandScale operand_scale) {
+  if (operand_scale == OperandScale::kSingle) {
+    switch (bytecode) {
+      case Bytecode::kTestEqual:
+      case Bytecode::kTestEqualStrict:
+      case Bytecode::kTestLessThan:
+      case Bytecode::kTestGreaterThan:
+      case Bytecode::kTestLessThanOrEqual:
+      case Bytecode::kTestGreaterThanOrEqual:
+      case Bytecode::kTestReferenceEqual:
+      case Bytecode::kTestUndetectable:
+      case Bytecode::kTestNull:
+      case Bytecode::kTestUndefined:
+      case Bytecode::kTestTypeOf:
         return true;
       default:
         return false;
@@ -285,7 +285,7 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
 
   // Dispatches to |target_bytecode| at BytecodeOffset(). Includes short-star
   // lookahead if the current bytecode_ is likely followed by a short-star
-  // instruction.
+  // instruction, and conditional jump lookahead if it is a comparison.
   void DispatchToBytecodeWithOptionalStarLookahead(
       TNode<WordT> target_bytecode);
 
@@ -449,6 +449,16 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for JumpIfTrue and JumpIfFalse and inline them in a branch,
+  // including subsequent dispatch. Anything after this point can assume that
+  // the following instruction was neither of them.
+  void JumpIfBooleanDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for |jump_bytecode|, which jumps if the accumulator equals
+  // |condition|, at the current BytecodeOffset(), and dispatch to the next
+  // bytecode.
+  void InlineJumpIfBoolean(Bytecode jump_bytecode, TNode<Boolean> condition);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
@@ -0,0 +1,67 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_CHAR_WORD_H_
+#define V8_JSON_JSON_CHAR_WORD_H_
+
+#include <limits>
+
+#include "src/base/memory.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Helpers for looking at a word's worth of JSON characters at a time (SWAR,
+// "SIMD within a register"). Each character of type {Char} occupies one lane
+// of a uintptr_t. All predicates are exact, i.e. they return true iff at
+// least one lane satisfies the condition.
+template <typename Char>
+struct JsonCharWord {
+  static constexpr size_t kCharsPerWord = sizeof(uintptr_t) / sizeof(Char);
+  // The lowest and the highest bit of every lane.
+  static constexpr uintptr_t kLowBits =
+      kUintptrAllBitsSet / std::numeric_limits<Char>::max();
+  static constexpr uintptr_t kHighBits =
+      kLowBits << (kBitsPerByte * sizeof(Char) - 1);
+
+  static uintptr_t Read(const Char* chars) {
+    return base::ReadUnalignedValue<uintptr_t>(
+        reinterpret_cast<Address>(chars));
+  }
+
+  static constexpr uintptr_t Broadcast(Char c) { return kLowBits * c; }
+
+  // Returns whether any lane of {word} is zero.
+  static constexpr bool HasZero(uintptr_t word) {
+    return ((word - kLowBits) & ~word & kHighBits) != 0;
+  }
+
+  // Returns whether any lane of {word} is less than {n}, which must not
+  // exceed 0x80.
+  static constexpr bool HasLess(uintptr_t word, Char n) {
+    return ((word - Broadcast(n)) & ~word & kHighBits) != 0;
+  }
+
+  // Returns whether any lane of {word} holds '"', '\\' or a control character.
+  // These are the characters that terminate a JSON string literal or start
+  // an escape sequence, and the one-byte characters that JSON.stringify
+  // escapes.
+  static constexpr bool HasQuoteBackslashOrControl(uintptr_t word) {
+    return HasLess(word, 0x20) || HasZero(word ^ Broadcast('"')) ||
+           HasZero(word ^ Broadcast('\\'));
+  }
+
+  // Returns whether any lane of {word} holds a (leading or trailing)
+  // surrogate. Only meaningful for two-byte characters.
+  static constexpr bool HasSurrogate(uintptr_t word) {
+    static_assert(sizeof(Char) == 2);
+    return HasZero((word & Broadcast(0xF800)) ^ Broadcast(0xD800));
+  }
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_CHAR_WORD_H_
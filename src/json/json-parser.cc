@@ -14,6 +14,7 @@
 #include "src/debug/debug.h"
 #include "src/execution/frames-inl.h"
 #include "src/heap/factory.h"
+#include "src/json/json-char-word.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/elements-kind.h"
@@ -128,6 +129,29 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Advances {cursor} over whole words of string characters that can't
+// terminate a JSON string. For two-byte strings, the characters skipped are
+// accumulated into {bits}, so that it can be decided whether the string fits
+// in one byte.
+template <typename Char>
+const Char* SkipJsonStringCharWords(const Char* cursor, const Char* end,
+                                    base::uc32* bits) {
+  using Word = JsonCharWord<Char>;
+  uintptr_t seen = 0;
+  while (static_cast<size_t>(end - cursor) >= Word::kCharsPerWord) {
+    uintptr_t word = Word::Read(cursor);
+    if (Word::HasQuoteBackslashOrControl(word)) break;
+    seen |= word;
+    cursor += Word::kCharsPerWord;
+  }
+  if (sizeof(Char) == 2) {
+    for (size_t i = 0; i < Word::kCharsPerWord; i++) {
+      *bits |= static_cast<Char>(seen >> (i * kBitsPerByte * sizeof(Char)));
+    }
+  }
+  return cursor;
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(
@@ -330,6 +354,11 @@ JsonParser<Char>::JsonParser(Isolate* isolate, Handle<String> source)
   }
   cursor_ = chars_ + start;
   end_ = cursor_ + length;
+
+  if (length >= kMinSourceLengthForObjectShapeCache) {
+    object_shape_cache_ = factory()->NewFixedArrayWithHoles(
+        kObjectShapeCacheSize);
+  }
 }
 
 template <typename Char>
@@ -562,15 +591,28 @@ JsonToken GetTokenForCharacter(Char c) {
 
 template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
+  using Word = JsonCharWord<Char>;
   JsonToken local_next = JsonToken::EOS;
 
-  cursor_ = std::find_if(cursor_, end_, [&](Char c) {
+  const Char* cursor = cursor_;
+  while (cursor != end_) {
+    Char c = *cursor;
+    // Skip runs of spaces, as used for indentation, a word at a time.
+    if (c == ' ' &&
+        static_cast<size_t>(end_ - cursor) >= Word::kCharsPerWord &&
+        Word::Read(cursor) == Word::Broadcast(' ')) {
+      cursor += Word::kCharsPerWord;
+      continue;
+    }
     JsonToken current = GetTokenForCharacter(c);
-    bool result = current != JsonToken::WHITESPACE;
-    if (V8_LIKELY(result)) local_next = current;
-    return result;
-  });
+    if (V8_LIKELY(current != JsonToken::WHITESPACE)) {
+      local_next = current;
+      break;
+    }
+    ++cursor;
+  }
 
+  cursor_ = cursor;
   next_ = local_next;
 }
 
@@ -1281,19 +1323,63 @@ class JsonParser<Char>::NamedPropertyIterator {
   const JsonProperty* end_;
 };
 
+template <typename Char>
+int JsonParser<Char>::ObjectShapeCacheIndex(const JsonContinuation& cont,
+                                            int named_length) {
+  DCHECK_LT(0, named_length);
+  // Hash the number of named properties and the first and last named key,
+  // which is cheap and tells apart most shapes in practice.
+  const JsonString* first = nullptr;
+  const JsonString* last = nullptr;
+  for (size_t i = cont.index; i < property_stack_.size(); i++) {
+    const JsonString& key = property_stack_[i].string;
+    if (key.is_index()) continue;
+    if (first == nullptr) first = &key;
+    last = &key;
+  }
+  DCHECK_NOT_NULL(first);
+  uint32_t hash = static_cast<uint32_t>(named_length);
+  DisallowGarbageCollection no_gc;
+  for (const JsonString* key : {first, last}) {
+    for (Char c : GetKeyChars(*key)) hash = hash * 31 + c;
+  }
+  return ComputeUnseededHash(hash) & (kObjectShapeCacheSize - 1);
+}
+
+template <typename Char>
+Handle<Map> JsonParser<Char>::LookupObjectShape(const JsonContinuation& cont,
+                                                int named_length) {
+  if (object_shape_cache_.is_null() || named_length == 0) return {};
+  Tagged<Object> entry =
+      object_shape_cache_->get(ObjectShapeCacheIndex(cont, named_length));
+  if (!IsMap(entry)) return {};
+  return handle(Cast<Map>(entry), isolate_);
+}
+
+template <typename Char>
+void JsonParser<Char>::RecordObjectShape(const JsonContinuation& cont,
+                                         int named_length, Tagged<Map> map) {
+  if (object_shape_cache_.is_null() || named_length == 0) return;
+  // Don't record maps that can't be reached through transitions again.
+  if (map->is_dictionary_map() || map->IsDetached(isolate_)) return;
+  object_shape_cache_->set(ObjectShapeCacheIndex(cont, named_length), map);
+}
+
 template <typename Char>
 template <bool should_track_json_source>
 Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
                                                    Handle<Map> feedback) {
-  if (!feedback.is_null() && feedback->is_deprecated()) {
-    feedback = Map::Update(isolate_, feedback);
-  }
   size_t start = cont.index;
   DCHECK_LE(start, property_stack_.size());
   int length = static_cast<int>(property_stack_.size() - start);
   int named_length = length - cont.elements;
   DCHECK_LE(0, named_length);
 
+  if (feedback.is_null()) feedback = LookupObjectShape(cont, named_length);
+  if (!feedback.is_null() && feedback->is_deprecated()) {
+    feedback = Map::Update(isolate_, feedback);
+  }
+
   Handle<FixedArrayBase> elements;
   ElementsKind elements_kind = HOLEY_ELEMENTS;
 
@@ -1347,7 +1433,10 @@ Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
   NamedPropertyIterator it(*this, property_stack_.begin() + start,
                            property_stack_.end());
 
-  return js_data_object_builder.BuildFromIterator(it, elements);
+  Handle<JSObject> object =
+      js_data_object_builder.BuildFromIterator(it, elements);
+  RecordObjectShape(cont, named_length, object->map());
+  return object;
 }
 
 template <typename Char>
@@ -2120,6 +2209,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    cursor_ = SkipJsonStringCharWords(cursor_, end_, &bits);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
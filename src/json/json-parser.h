@@ -338,6 +338,19 @@ class JsonParser final {
                                    Handle<Map> feedback);
   Handle<Object> BuildJsonArray(size_t start);
 
+  // The object shape cache maps the named keys of objects built during this
+  // parse to the map the object ended up with. It provides an expected final
+  // map for objects that don't get feedback from a preceding array element,
+  // e.g. objects nested in array elements. Entries are only hints: the
+  // expected final map is validated key by key while building the object.
+  static const int kObjectShapeCacheSize = 64;
+  static const int kMinSourceLengthForObjectShapeCache = 1024;
+  int ObjectShapeCacheIndex(const JsonContinuation& cont, int named_length);
+  Handle<Map> LookupObjectShape(const JsonContinuation& cont,
+                                int named_length);
+  void RecordObjectShape(const JsonContinuation& cont, int named_length,
+                         Tagged<Map> map);
+
   static const int kMaxContextCharacters = 10;
   static const int kMinOriginalSourceLengthForContext =
       (kMaxContextCharacters * 2) + 1;
@@ -409,6 +422,9 @@ class JsonParser final {
 
   SmallVector<Handle<Object>> element_stack_;
   SmallVector<JsonProperty> property_stack_;
+  // Only allocated for sufficiently large sources, see
+  // {kMinSourceLengthForObjectShapeCache}.
+  Handle<FixedArray> object_shape_cache_;
 
   // Cached pointer to the raw chars in source. In case source is on-heap, we
   // register an UpdatePointers callback. For this reason, chars_, cursor_ and
@@ -8,6 +8,7 @@
 #include "src/common/assert-scope.h"
 #include "src/common/message-template.h"
 #include "src/execution/protectors-inl.h"
+#include "src/json/json-char-word.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/elements-kind.h"
 #include "src/objects/heap-number-inl.h"
@@ -1414,6 +1415,28 @@ JsonStringifier::Result JsonStringifier::SerializeJSProxy(
   return SUCCESS;
 }
 
+namespace {
+
+// Returns the index of the first character at or after {from} that might have
+// to be escaped, skipping whole words of characters that don't.
+template <typename SrcChar>
+V8_INLINE int SkipJsonCharsNotNeedingEscape(base::Vector<const SrcChar> src,
+                                            int from) {
+  using Word = JsonCharWord<SrcChar>;
+  constexpr int kCharsPerWord = static_cast<int>(Word::kCharsPerWord);
+  while (src.length() - from >= kCharsPerWord) {
+    uintptr_t word = Word::Read(src.begin() + from);
+    if (Word::HasQuoteBackslashOrControl(word)) break;
+    if constexpr (sizeof(SrcChar) == 2) {
+      if (Word::HasSurrogate(word)) break;
+    }
+    from += kCharsPerWord;
+  }
+  return from;
+}
+
+}  // namespace
+
 template <typename SrcChar, typename DestChar, bool raw_json>
 bool JsonStringifier::SerializeStringUnchecked_(
     base::Vector<const SrcChar> src, NoExtendBuilder<DestChar>* dest) {
@@ -1423,6 +1446,11 @@ bool JsonStringifier::SerializeStringUnchecked_(
   bool required_escaping = false;
   int prev_escaped_offset = -1;
   for (int i = 0; i < src.length(); i++) {
+    if constexpr (!raw_json) {
+      // Runs of characters that don't need escaping are copied in bulk below.
+      i = SkipJsonCharsNotNeedingEscape(src, i);
+      if (i == src.length()) break;
+    }
     SrcChar c = src[i];
     if (raw_json || DoNotEscape(c)) {
       continue;
@@ -1504,6 +1532,10 @@ bool JsonStringifier::SerializeString_(Tagged<String> string,
             String::IsOneByteRepresentationUnderneath(string)));
     int prev_escaped_offset = -1;
     for (int i = 0; i < vector.length(); i++) {
+      if constexpr (!raw_json) {
+        i = SkipJsonCharsNotNeedingEscape(vector, i);
+        if (i == vector.length()) break;
+      }
       SrcChar c = vector.at(i);
       if (raw_json || DoNotEscape(c)) {
         continue;
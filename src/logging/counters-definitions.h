@@ -321,6 +321,9 @@ namespace internal {
   HT(deserialize_script_on_background,                                         \
      V8.CompileScriptMicroSeconds.ConsumeCache.BackgroundThread, 1000000,      \
      MICROSECOND)                                                              \
+  /* Main-thread part of merging with a script from the Isolate cache. */      \
+  HT(compile_script_merge_in_foreground,                                       \
+     V8.CompileScriptMicroSeconds.MergeInForeground, 1000000, MICROSECOND)     \
   /* Debugger timers. */                                                       \
   HT(debug_pause_to_paused_event, V8.DebugPauseToPausedEventMilliSeconds,      \
      1000000, MILLISECOND)
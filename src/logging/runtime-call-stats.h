@@ -179,6 +179,7 @@ class RuntimeCallTimer final {
   V(Isolate_DateTimeConfigurationChangeNotification)       \
   V(Isolate_LocaleConfigurationChangeNotification)         \
   V(JSON_Parse)                                            \
+  V(JSON_ParseStream)                                      \
   V(JSON_Stringify)                                        \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
@@ -437,6 +438,7 @@ class RuntimeCallTimer final {
   V(AccessorSetterCallback)                    \
   V(ArrayLengthGetter)                         \
   V(ArrayLengthSetter)                         \
+  V(AtomicsObjectGetter)                       \
   V(BoundFunctionLengthGetter)                 \
   V(BoundFunctionNameGetter)                   \
   V(CodeGenerationFromStringsCallbacks)        \
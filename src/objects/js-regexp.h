@@ -260,6 +260,9 @@ class IrRegExpData : public RegExpData {
   DECL_INT_ACCESSORS(capture_count)
   DECL_INT_ACCESSORS(ticks_until_tier_up)
   DECL_INT_ACCESSORS(backtrack_limit)
+  // A string that every match contains at or after its start, or Smi zero if
+  // there is none. Used to reject subjects before running the matcher.
+  DECL_ACCESSORS(required_literal, Tagged<Object>)
 
   bool CanTierUp();
   bool MarkedForTierUp();
@@ -288,6 +291,7 @@ class IrRegExpData : public RegExpData {
   V(kCaptureCountOffset, kTaggedSize)             \
   V(kTicksUntilTierUpOffset, kTaggedSize)         \
   V(kBacktrackLimitOffset, kTaggedSize)           \
+  V(kRequiredLiteralOffset, kTaggedSize)          \
   V(kHeaderSize, 0)                               \
   V(kSize, 0)
 
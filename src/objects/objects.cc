@@ -4319,6 +4319,24 @@ bool Script::IsUserJavaScript() const {
   return type() == Script::Type::kNormal;
 }
 
+void Script::CompactCompiledLazyFunctionPositions() {
+  DisallowGarbageCollection no_gc;
+  if (IsUndefined(compiled_lazy_function_positions())) return;
+  Tagged<ArrayList> list = Cast<ArrayList>(compiled_lazy_function_positions());
+  std::vector<int> positions;
+  positions.reserve(list->length());
+  for (int i = 0; i < list->length(); ++i) {
+    positions.push_back(Smi::ToInt(list->get(i)));
+  }
+  std::sort(positions.begin(), positions.end());
+  positions.erase(std::unique(positions.begin(), positions.end()),
+                  positions.end());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    list->set(static_cast<int>(i), Smi::FromInt(positions[i]));
+  }
+  list->set_length(static_cast<int>(positions.size()));
+}
+
 #if V8_ENABLE_WEBASSEMBLY
 bool Script::ContainsAsmModule() {
   DisallowGarbageCollection no_gc;
@@ -150,6 +150,11 @@ class Script : public TorqueGeneratedScript<Script, Struct> {
 
   DECL_ACCESSORS(compiled_lazy_function_positions, Tagged<Object>)
 
+  // Sorts compiled_lazy_function_positions and removes duplicate entries,
+  // which are recorded when a function is recompiled after its bytecode was
+  // flushed.
+  void CompactCompiledLazyFunctionPositions();
+
   // If script source is an external string, check that the underlying
   // resource is accessible. Otherwise, always return true.
   inline bool HasValidSource();
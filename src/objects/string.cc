@@ -1251,6 +1251,81 @@ int SearchString(Isolate* isolate, String::FlatContent receiver_content,
                       start_index);
 }
 
+// Patterns up to this length are searched in cons strings segment by segment
+// instead of flattening the receiver.
+constexpr uint32_t kMaxSegmentedSearchPatternLength = 32;
+// Ropes built from many small pieces are cheaper to flatten once than to
+// traverse on every search, so the segmented search gives up after seeing
+// this many segments shorter than {kMinSegmentedSearchSegmentLength}.
+constexpr int kMaxSegmentedSearchShortSegments = 64;
+constexpr int kMinSegmentedSearchSegmentLength = 256;
+constexpr int kSegmentedSearchGaveUp = -2;
+
+// Searches {pattern} in the cons string {receiver} without flattening it. The
+// segments are searched one by one, and matches that span a segment boundary
+// are found by searching a window made of the last {pattern_length - 1}
+// characters before the boundary and the first {pattern_length - 1}
+// characters after it. Returns {kSegmentedSearchGaveUp} if the receiver
+// consists of too many short segments.
+template <typename PatternChar>
+int SearchConsString(Isolate* isolate, Tagged<ConsString> receiver,
+                     base::Vector<const PatternChar> pattern,
+                     uint32_t start_index,
+                     const DisallowGarbageCollection& no_gc) {
+  const int overlap = pattern.length() - 1;
+  DCHECK_LE(pattern.length(),
+            static_cast<int>(kMaxSegmentedSearchPatternLength));
+  base::uc16 window[2 * kMaxSegmentedSearchPatternLength];
+  int window_length = 0;
+  int short_segments = 0;
+
+  ConsStringIterator iter(receiver, start_index);
+  // The absolute index of the first character of the current segment that is
+  // searched, i.e. the one at {offset}.
+  uint32_t position = start_index;
+  int offset = 0;
+  for (Tagged<String> segment = iter.Next(&offset); !segment.is_null();
+       segment = iter.Next(&offset)) {
+    const int segment_length = segment->length() - offset;
+    if (segment_length < kMinSegmentedSearchSegmentLength &&
+        ++short_segments > kMaxSegmentedSearchShortSegments) {
+      return kSegmentedSearchGaveUp;
+    }
+
+    // Matches starting before this segment and ending in it.
+    if (window_length > 0) {
+      const int head = std::min(overlap, segment_length);
+      String::WriteToFlat(segment, window + window_length, offset, head);
+      int index = SearchString(
+          isolate,
+          base::Vector<const base::uc16>(window, window_length + head),
+          pattern, 0);
+      if (index >= 0 && index < window_length) {
+        return position - window_length + index;
+      }
+    }
+
+    // Matches within this segment.
+    String::FlatContent content = segment->GetFlatContent(no_gc);
+    int index = SearchString(isolate, content, pattern, offset);
+    if (index >= 0) return position + (index - offset);
+
+    // Keep the last {overlap} characters for the next boundary.
+    if (segment_length >= overlap) {
+      window_length = overlap;
+      String::WriteToFlat(segment, window, segment->length() - overlap,
+                          overlap);
+    } else {
+      const int keep = std::min(window_length, overlap - segment_length);
+      std::copy(window + window_length - keep, window + window_length, window);
+      String::WriteToFlat(segment, window + keep, offset, segment_length);
+      window_length = keep + segment_length;
+    }
+    position += segment_length;
+  }
+  return -1;
+}
+
 }  // namespace
 
 int String::IndexOf(Isolate* isolate, Handle<String> receiver,
@@ -1263,9 +1338,27 @@ int String::IndexOf(Isolate* isolate, Handle<String> receiver,
   uint32_t receiver_length = receiver->length();
   if (start_index + search_length > receiver_length) return -1;
 
-  receiver = String::Flatten(isolate, receiver);
   search = String::Flatten(isolate, search);
 
+  // Ropes are searched segment by segment for short patterns, which saves
+  // flattening them when the result is all that is needed.
+  if (IsConsString(*receiver) && !receiver->IsFlat() &&
+      search_length <= kMaxSegmentedSearchPatternLength) {
+    DisallowGarbageCollection no_gc;
+    Tagged<ConsString> cons = Cast<ConsString>(*receiver);
+    String::FlatContent search_content = search->GetFlatContent(no_gc);
+    int result =
+        search_content.IsOneByte()
+            ? SearchConsString(isolate, cons,
+                               search_content.ToOneByteVector(), start_index,
+                               no_gc)
+            : SearchConsString(isolate, cons, search_content.ToUC16Vector(),
+                               start_index, no_gc);
+    if (result != kSegmentedSearchGaveUp) return result;
+  }
+
+  receiver = String::Flatten(isolate, receiver);
+
   DisallowGarbageCollection no_gc;  // ensure vectors stay valid
   // Extract flattened substrings of cons strings before getting encoding.
   String::FlatContent receiver_content = receiver->GetFlatContent(no_gc);
@@ -38,6 +38,8 @@ UnoptimizedCompileFlags::UnoptimizedCompileFlags(Isolate* isolate,
                                isolate->NeedsDetailedOptimizedCodeLineInfo());
   set_post_parallel_compile_tasks_for_eager_toplevel(
       v8_flags.parallel_compile_tasks_for_eager_toplevel);
+  set_post_parallel_compile_tasks_for_eager_inner(
+      v8_flags.parallel_compile_tasks_for_eager_inner);
   set_post_parallel_compile_tasks_for_lazy(
       v8_flags.parallel_compile_tasks_for_lazy);
 }
@@ -2710,6 +2710,9 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
       eager_compile_hint == FunctionLiteral::kShouldLazyCompile;
   const bool is_top_level = AllowsLazyParsingWithoutUnresolvedVariables();
   const bool is_eager_top_level_function = !is_lazy && is_top_level;
+  // Eager functions nested in other functions, e.g. the IIFEs inside the
+  // top-level wrapper function of a bundle.
+  const bool is_eager_inner_function = !is_lazy && !is_top_level;
 
   RCS_SCOPE(runtime_call_stats_, RuntimeCallCounterId::kParseFunctionLiteral,
             RuntimeCallStats::kThreadSpecific);
@@ -2734,6 +2737,8 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
       can_post_parallel_task && !flags().is_reparse() &&
       ((is_eager_top_level_function &&
         flags().post_parallel_compile_tasks_for_eager_toplevel()) ||
+       (is_eager_inner_function &&
+        flags().post_parallel_compile_tasks_for_eager_inner()) ||
        (is_lazy && flags().post_parallel_compile_tasks_for_lazy()));
 
   // Determine whether we should lazy parse the inner function. This will be
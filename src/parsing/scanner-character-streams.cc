@@ -619,6 +619,19 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   }
 
   while (cursor < end && chars < position) {
+    // Fast path for ascii sequences, where every byte is one character. This
+    // makes seeking in mostly-ascii sources (e.g. by the cloned streams of
+    // parallel compile tasks) cheap even within a single large chunk.
+    if (state == unibrow::Utf8::State::kAccept) {
+      size_t max_length =
+          std::min({static_cast<size_t>(end - cursor), position - chars,
+                    static_cast<size_t>(kMaxUInt32)});
+      uint32_t ascii_length =
+          NonAsciiStart(cursor, static_cast<uint32_t>(max_length));
+      cursor += ascii_length;
+      chars += ascii_length;
+      if (cursor == end || chars == position) break;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
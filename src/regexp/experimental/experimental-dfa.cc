@@ -0,0 +1,162 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-dfa.h"
+
+#include <algorithm>
+
+namespace v8 {
+namespace internal {
+
+ExperimentalRegExpLazyDfa::ExperimentalRegExpLazyDfa(
+    base::Vector<const RegExpInstruction> bytecode, size_t max_memory_usage,
+    Zone* zone)
+    : bytecode_(bytecode.begin(), bytecode.end(), zone),
+      zone_(zone),
+      class_starts_(zone),
+      state_ids_(zone),
+      states_(zone),
+      transitions_(zone),
+      max_memory_usage_(max_memory_usage),
+      visited_(bytecode.size(), 0, zone),
+      worklist_(zone) {
+  // Split the characters into classes such that every CONSUME_RANGE either
+  // contains all or none of the characters of a class.
+  class_starts_.push_back(0);
+  for (const RegExpInstruction& inst : bytecode_) {
+    if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+    const RegExpInstruction::Uc16Range& range = inst.payload.consume_range;
+    if (range.min > range.max) continue;  // Fail instruction.
+    class_starts_.push_back(range.min);
+    if (range.max != 0xFFFF) class_starts_.push_back(range.max + 1);
+  }
+  std::sort(class_starts_.begin(), class_starts_.end());
+  class_starts_.erase(std::unique(class_starts_.begin(), class_starts_.end()),
+                      class_starts_.end());
+  class_count_ = static_cast<int>(class_starts_.size());
+  for (int c = 0; c < kLatin1ClassCount; ++c) {
+    latin1_classes_[c] = LookupCharClass(static_cast<base::uc16>(c));
+  }
+
+  memory_usage_ = sizeof(*this) +
+                  bytecode_.size() * sizeof(RegExpInstruction) +
+                  class_starts_.capacity() * sizeof(base::uc16) +
+                  visited_.size() * sizeof(int);
+}
+
+int ExperimentalRegExpLazyDfa::ComputeStartState() {
+  ZoneVector<int> start_pcs(zone_);
+  ++visit_epoch_;
+  AddClosure(0, &start_pcs);
+  return InternState(std::move(start_pcs));
+}
+
+int ExperimentalRegExpLazyDfa::LookupCharClass(base::uc16 c) const {
+  auto it = std::upper_bound(class_starts_.begin(), class_starts_.end(), c);
+  DCHECK(it != class_starts_.begin());
+  return static_cast<int>(it - class_starts_.begin()) - 1;
+}
+
+void ExperimentalRegExpLazyDfa::AddClosure(int pc, ZoneVector<int>* result) {
+  worklist_.clear();
+  worklist_.push_back(pc);
+  while (!worklist_.empty()) {
+    int current = worklist_.back();
+    worklist_.pop_back();
+    if (visited_[current] == visit_epoch_) continue;
+    visited_[current] = visit_epoch_;
+    const RegExpInstruction& inst = bytecode_[current];
+    switch (inst.opcode) {
+      case RegExpInstruction::CONSUME_RANGE:
+        if (inst.payload.consume_range.min <= inst.payload.consume_range.max) {
+          result->push_back(current);
+        }
+        break;
+      case RegExpInstruction::ACCEPT:
+        result->push_back(current);
+        break;
+      case RegExpInstruction::FORK:
+        worklist_.push_back(current + 1);
+        worklist_.push_back(inst.payload.pc);
+        break;
+      case RegExpInstruction::JMP:
+        worklist_.push_back(inst.payload.pc);
+        break;
+      case RegExpInstruction::ASSERTION:
+      case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+      case RegExpInstruction::BEGIN_LOOP:
+      case RegExpInstruction::END_LOOP:
+      case RegExpInstruction::SET_REGISTER_TO_CP:
+      case RegExpInstruction::CLEAR_REGISTER:
+      case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+        // These only ever restrict the matches, see the class comment.
+        worklist_.push_back(current + 1);
+        break;
+      case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+      case RegExpInstruction::FILTER_QUANTIFIER:
+      case RegExpInstruction::FILTER_GROUP:
+      case RegExpInstruction::FILTER_CHILD:
+        // Not reachable from the main expression.
+        break;
+    }
+  }
+}
+
+int ExperimentalRegExpLazyDfa::InternState(ZoneVector<int> pcs) {
+  std::sort(pcs.begin(), pcs.end());
+  pcs.erase(std::unique(pcs.begin(), pcs.end()), pcs.end());
+  auto [it, inserted] =
+      state_ids_.emplace(std::move(pcs), static_cast<int>(states_.size()));
+  if (!inserted) return it->second;
+
+  // The key and the map node, the new row of transitions, and the state
+  // itself.
+  memory_usage_ += it->first.size() * sizeof(int) + 4 * sizeof(void*) +
+                   class_count_ * sizeof(int) + sizeof(State);
+
+  bool accepting = std::any_of(it->first.begin(), it->first.end(), [&](int pc) {
+    return bytecode_[pc].opcode == RegExpInstruction::ACCEPT;
+  });
+  states_.push_back(State{&it->first, accepting});
+  transitions_.resize(transitions_.size() + class_count_, kUnknownState);
+  return it->second;
+}
+
+int ExperimentalRegExpLazyDfa::ComputeNext(int state, int char_class) {
+  if (memory_usage_ > max_memory_usage_) return kGaveUp;
+  if (static_cast<int>(states_.size()) >= kMaxStates) {
+    if (cache_flushes_ == kMaxCacheFlushes) return kGaveUp;
+    // Keep only the current state.
+    const ZoneVector<int>& state_pcs = *states_[state].pcs;
+    ZoneVector<int> pcs(state_pcs.begin(), state_pcs.end(), zone_);
+    FlushCache();
+    state = InternState(std::move(pcs));
+  }
+
+  const base::uc16 c = class_starts_[char_class];
+  ZoneVector<int> next_pcs(zone_);
+  ++visit_epoch_;
+  for (int pc : *states_[state].pcs) {
+    const RegExpInstruction& inst = bytecode_[pc];
+    if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+    if (inst.payload.consume_range.min <= c &&
+        c <= inst.payload.consume_range.max) {
+      AddClosure(pc + 1, &next_pcs);
+    }
+  }
+  int next = InternState(std::move(next_pcs));
+  transitions_[state * class_count_ + char_class] = next;
+  return next;
+}
+
+void ExperimentalRegExpLazyDfa::FlushCache() {
+  ++cache_flushes_;
+  state_ids_.clear();
+  states_.clear();
+  transitions_.clear();
+  start_state_ = kUnknownState;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,119 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
+
+#include "src/base/strings.h"
+#include "src/base/vector.h"
+#include "src/regexp/experimental/experimental-bytecode.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+
+// A DFA for experimental regexp bytecode, built lazily by subset construction
+// while the input is scanned. States are the sets of CONSUME_RANGE and ACCEPT
+// instructions reachable without consuming input; transitions are computed on
+// first use and cached.
+//
+// The DFA ignores everything that doesn't affect which characters are
+// consumed: capture registers, the priority between threads, assertions,
+// lookbehinds and the restriction on empty quantifier iterations. It thus
+// accepts a superset of the inputs the NFA accepts, and is only used to rule
+// out that there is a match at all, which is the common case when scanning
+// large inputs. If the DFA reaches an accepting state, the NFA interpreter
+// computes the actual match.
+//
+// The number of states is bounded: when the cache is full, it is flushed and
+// construction starts over from the current state. If that happens too often,
+// or if the zone memory used by the DFA exceeds {max_memory_usage}, the DFA
+// gives up.
+class ExperimentalRegExpLazyDfa final : public ZoneObject {
+ public:
+  ExperimentalRegExpLazyDfa(base::Vector<const RegExpInstruction> bytecode,
+                            size_t max_memory_usage, Zone* zone);
+
+  // Returned by {Next} if the DFA gave up.
+  static constexpr int kGaveUp = -1;
+
+  int start_state() {
+    if (start_state_ == kUnknownState) start_state_ = ComputeStartState();
+    return start_state_;
+  }
+  bool IsAccepting(int state) const { return states_[state].accepting; }
+  // A state without any consuming instructions never reaches an accepting
+  // state.
+  bool IsDead(int state) const { return states_[state].pcs->empty(); }
+
+  // An approximation of the zone memory allocated by the DFA so far. Memory
+  // of flushed states is not reclaimed by the zone and stays included.
+  size_t memory_usage() const { return memory_usage_; }
+
+  // Returns the state reached from {state} by consuming {c}, or {kGaveUp}.
+  // Note that this might flush the cache, which invalidates all other state
+  // ids.
+  int Next(int state, base::uc16 c) {
+    int transition = state * class_count_ + CharClass(c);
+    int next = transitions_[transition];
+    if (V8_LIKELY(next != kUnknownState)) return next;
+    return ComputeNext(state, CharClass(c));
+  }
+
+ private:
+  static constexpr int kUnknownState = -2;
+  static constexpr int kMaxStates = 1024;
+  static constexpr int kMaxCacheFlushes = 8;
+
+  struct State {
+    const ZoneVector<int>* pcs;
+    bool accepting;
+  };
+
+  int CharClass(base::uc16 c) const {
+    if (c < kLatin1ClassCount) return latin1_classes_[c];
+    return LookupCharClass(c);
+  }
+  int LookupCharClass(base::uc16 c) const;
+
+  // Adds the CONSUME_RANGE and ACCEPT instructions reachable from {pc}
+  // without consuming input to {result}. Instructions visited since the last
+  // increment of {visit_epoch_} are skipped.
+  void AddClosure(int pc, ZoneVector<int>* result);
+  int ComputeStartState();
+  int InternState(ZoneVector<int> pcs);
+  int ComputeNext(int state, int char_class);
+  void FlushCache();
+
+  static constexpr int kLatin1ClassCount = 256;
+
+  // A copy of the bytecode, which doesn't move during GC.
+  const ZoneVector<RegExpInstruction> bytecode_;
+  Zone* zone_;
+
+  // The first character of each character class, in increasing order. All
+  // characters of a class are treated the same by every CONSUME_RANGE.
+  ZoneVector<base::uc16> class_starts_;
+  int class_count_;
+  uint16_t latin1_classes_[kLatin1ClassCount];
+
+  ZoneMap<ZoneVector<int>, int> state_ids_;
+  ZoneVector<State> states_;
+  // Indexed by `state * class_count_ + char_class`.
+  ZoneVector<int> transitions_;
+  int start_state_ = kUnknownState;
+  int cache_flushes_ = 0;
+  const size_t max_memory_usage_;
+  size_t memory_usage_;
+
+  // Scratch space for {AddClosure}.
+  ZoneVector<int> visited_;
+  ZoneVector<int> worklist_;
+  int visit_epoch_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
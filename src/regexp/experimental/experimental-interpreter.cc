@@ -12,6 +12,7 @@
 #include "src/flags/flags.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/string-inl.h"
+#include "src/regexp/experimental/experimental-dfa.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/zone/zone-allocator.h"
@@ -301,6 +302,8 @@ class NfaInterpreter {
         lookbehind_pc_(0, zone),
         filter_groups_pc_(std::nullopt),
         lookbehind_table_(0, zone),
+        dfa_enabled_(v8_flags.experimental_regexp_engine_dfa),
+        dfa_(nullptr),
         zone_(zone) {
     DCHECK(!bytecode_.empty());
     DCHECK_GE(input_index_, 0);
@@ -555,6 +558,23 @@ class NfaInterpreter {
       best_match_thread_ = std::nullopt;
     }
 
+    // Building the DFA only pays off if there is enough input left to scan.
+    static constexpr int kMinDfaInputLength = 1024;
+    if (dfa_enabled_ && dfa_ == nullptr &&
+        input_.length() - input_index_ >= kMinDfaInputLength) {
+      dfa_ = zone_->New<ExperimentalRegExpLazyDfa>(bytecode_, MaxMemoryUsage(),
+                                                   zone_);
+    }
+    if (dfa_enabled_ && dfa_ != nullptr) {
+      bool may_match;
+      int err_code = MayMatch(&may_match);
+      if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      if (!may_match) {
+        input_index_ = input_.length();
+        return RegExp::kInternalRegExpSuccess;
+      }
+    }
+
     // The lookbehind threads need to be executed before the thread of their
     // parent (lookbehind or main expression). The order of the bytecode (see
     // also `BytecodeAssembler`) ensures that they need to be executed from last
@@ -602,6 +622,41 @@ class NfaInterpreter {
     return RegExp::kInternalRegExpSuccess;
   }
 
+  // Runs `dfa_` on the input starting at `input_index_` and sets `may_match`
+  // to false if it proves that there is no match.  The DFA accepts a superset
+  // of the inputs the NFA accepts, so this is only a prefilter: if it reaches
+  // an accepting state, the NFA still has to compute the actual match.  The
+  // DFA stops at its first accepting state, which is never after the end of
+  // the match the NFA then finds, so scanning all matches of a global regexp
+  // stays linear.  Returns RegExp::kInternalRegExpSuccess or an error code due
+  // to interrupt.
+  int MayMatch(bool* may_match) {
+    *may_match = true;
+    int state = dfa_->start_state();
+    for (int i = input_index_; !dfa_->IsAccepting(state); ++i) {
+      if (dfa_->IsDead(state) || i == input_.length()) {
+        *may_match = false;
+        return RegExp::kInternalRegExpSuccess;
+      }
+
+      static constexpr int kTicksBetweenInterruptHandling = 1024;
+      if (i % kTicksBetweenInterruptHandling == 0) {
+        int err_code = HandleInterrupts();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      }
+
+      state = dfa_->Next(state, input_[i]);
+      if (state == ExperimentalRegExpLazyDfa::kGaveUp) {
+        // Too many states or too much memory, fall back to the NFA for the
+        // rest of this exec.
+        // `dfa_` is kept to account for the memory it used.
+        dfa_enabled_ = false;
+        return RegExp::kInternalRegExpSuccess;
+      }
+    }
+    return RegExp::kInternalRegExpSuccess;
+  }
+
   // Run an active thread `t` until it executes a CONSUME_RANGE or ACCEPT
   // instruction, or its PC value was already processed.
   // - If processing of `t` can't continue because of CONSUME_RANGE, it is
@@ -809,22 +864,30 @@ class NfaInterpreter {
            memory_consumption_per_thread_;
   }
 
+  size_t DfaMemoryUsage() const {
+    return dfa_ != nullptr ? dfa_->memory_usage() : 0;
+  }
+
+  static size_t MaxMemoryUsage() {
+    return v8_flags
+               .experimental_regexp_engine_capture_group_opt_max_memory_usage *
+           MB;
+  }
+
   // Checks that the approximative memory usage does not go past a fixed
   // threshold. Returns the appropriate error code.
   int CheckMemoryConsumption() {
     DCHECK(v8_flags.experimental_regexp_engine_capture_group_opt);
 
     // Copmputes an approximation of the total current memory usage of the
-    // intepreter. It is based only on the threads' consumption, since the rest
-    // is negligible in comparison.
+    // intepreter. It is based only on the threads' consumption and the DFA,
+    // since the rest is negligible in comparison.
     uint64_t approx = (blocked_threads_.length() + active_threads_.length()) *
-                      memory_consumption_per_thread_;
+                          memory_consumption_per_thread_ +
+                      DfaMemoryUsage();
 
-    return (approx <
-            v8_flags.experimental_regexp_engine_capture_group_opt_max_memory_usage *
-                MB)
-               ? RegExp::kInternalRegExpSuccess
-               : RegExp::kInternalRegExpException;
+    return approx < MaxMemoryUsage() ? RegExp::kInternalRegExpSuccess
+                                     : RegExp::kInternalRegExpException;
   }
 
   base::Vector<int> GetRegisterArray(InterpreterThread t) {
@@ -1089,6 +1152,12 @@ class NfaInterpreter {
   // lookbehind of index k did complete a match on the current position.
   ZoneList<bool> lookbehind_table_;
 
+  // Lazily built DFA used to skip inputs without any match, see `MayMatch`.
+  // Only built once the remaining input is long enough. `dfa_enabled_` is
+  // false if the DFA is disabled or gave up.
+  bool dfa_enabled_;
+  ExperimentalRegExpLazyDfa* dfa_;
+
   uint64_t memory_consumption_per_thread_;
 
   Zone* zone_;
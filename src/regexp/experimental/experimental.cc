@@ -28,6 +28,63 @@ bool ExperimentalRegExp::CanBeHandled(RegExpTree* tree, Handle<String> pattern,
   return can_be_handled;
 }
 
+namespace {
+
+// Returns whether {tree} contains an unbounded quantifier whose body can match
+// a non-empty string.  {in_unbounded_quantifier} is set if {tree} is nested in
+// such a quantifier, in which case any further one is reported as unsafe.
+bool ContainsNestedUnboundedQuantifier(RegExpTree* tree,
+                                       bool in_unbounded_quantifier,
+                                       int depth) {
+  // Give up on deeply nested patterns; they aren't auto-selected.
+  static constexpr int kMaxDepth = 64;
+  if (depth > kMaxDepth) return false;
+  if (RegExpDisjunction* disjunction = tree->AsDisjunction()) {
+    for (RegExpTree* alternative : *disjunction->alternatives()) {
+      if (ContainsNestedUnboundedQuantifier(
+              alternative, in_unbounded_quantifier, depth + 1)) {
+        return true;
+      }
+    }
+    return false;
+  }
+  if (RegExpAlternative* alternative = tree->AsAlternative()) {
+    for (RegExpTree* node : *alternative->nodes()) {
+      if (ContainsNestedUnboundedQuantifier(node, in_unbounded_quantifier,
+                                            depth + 1)) {
+        return true;
+      }
+    }
+    return false;
+  }
+  if (RegExpQuantifier* quantifier = tree->AsQuantifier()) {
+    const bool unbounded = quantifier->max() == RegExpTree::kInfinity &&
+                           quantifier->body()->max_match() > 0;
+    if (unbounded && in_unbounded_quantifier) return true;
+    return ContainsNestedUnboundedQuantifier(
+        quantifier->body(), in_unbounded_quantifier || unbounded, depth + 1);
+  }
+  if (RegExpCapture* capture = tree->AsCapture()) {
+    return ContainsNestedUnboundedQuantifier(
+        capture->body(), in_unbounded_quantifier, depth + 1);
+  }
+  if (RegExpGroup* group = tree->AsGroup()) {
+    return ContainsNestedUnboundedQuantifier(
+        group->body(), in_unbounded_quantifier, depth + 1);
+  }
+  if (RegExpLookaround* lookaround = tree->AsLookaround()) {
+    return ContainsNestedUnboundedQuantifier(
+        lookaround->body(), in_unbounded_quantifier, depth + 1);
+  }
+  return false;
+}
+
+}  // namespace
+
+bool ExperimentalRegExp::IsBacktrackingUnsafe(RegExpTree* tree) {
+  return ContainsNestedUnboundedQuantifier(tree, false, 0);
+}
+
 void ExperimentalRegExp::Initialize(Isolate* isolate, DirectHandle<JSRegExp> re,
                                     DirectHandle<String> source,
                                     RegExpFlags flags, int capture_count) {
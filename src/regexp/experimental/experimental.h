@@ -22,6 +22,10 @@ class ExperimentalRegExp final : public AllStatic {
   // AST again is more flexible and less error prone (but less performant).
   static bool CanBeHandled(RegExpTree* tree, Handle<String> pattern,
                            RegExpFlags flags, int capture_count);
+  // Check whether a parsed regexp pattern contains an unbounded quantifier
+  // nested in another one, e.g. /(a+)+b/, which can make backtracking take
+  // exponential time.
+  static bool IsBacktrackingUnsafe(RegExpTree* tree);
   static void Initialize(Isolate* isolate, DirectHandle<JSRegExp> re,
                          DirectHandle<String> pattern, RegExpFlags flags,
                          int capture_count);
@@ -247,6 +247,18 @@ MaybeHandle<Object> RegExp::Compile(Isolate* isolate, Handle<JSRegExp> re,
     ExperimentalRegExp::Initialize(isolate, re, pattern, flags,
                                    parse_result.capture_count);
     has_been_compiled = true;
+  } else if (v8_flags.experimental_regexp_engine_for_unsafe_patterns &&
+             ExperimentalRegExp::IsBacktrackingUnsafe(parse_result.tree) &&
+             ExperimentalRegExp::CanBeHandled(parse_result.tree, pattern, flags,
+                                              parse_result.capture_count)) {
+    DCHECK(v8_flags.enable_experimental_regexp_engine);
+    if (v8_flags.trace_regexp_tier_up) {
+      PrintF("RegExp %s uses the experimental engine (nested quantifiers)\n",
+             pattern->ToCString().get());
+    }
+    ExperimentalRegExp::Initialize(isolate, re, pattern, flags,
+                                   parse_result.capture_count);
+    has_been_compiled = true;
   } else if (parse_result.simple && !IsIgnoreCase(flags) && !IsSticky(flags) &&
              !HasFewDifferentCharacters(pattern)) {
     // Parse-tree is a single atom that is equal to the pattern.
@@ -551,6 +563,86 @@ Handle<FixedArray> RegExp::CreateCaptureNameMap(
   return array;
 }
 
+namespace {
+
+// Returns a literal that every match of {tree} contains at or after the start
+// of the match, or an empty vector if there is none. Only the longest atom
+// along the mandatory path is considered; disjunctions, optional quantifiers
+// and lookbehinds (which may look before the match start) end the search.
+base::Vector<const base::uc16> FindRequiredLiteral(RegExpTree* tree) {
+  if (RegExpAtom* atom = tree->AsAtom()) return atom->data();
+  base::Vector<const base::uc16> best;
+  if (RegExpText* text = tree->AsText()) {
+    for (const TextElement& element : *text->elements()) {
+      if (element.text_type() != TextElement::ATOM) continue;
+      base::Vector<const base::uc16> data = element.atom()->data();
+      if (data.length() > best.length()) best = data;
+    }
+    return best;
+  }
+  if (RegExpAlternative* alternative = tree->AsAlternative()) {
+    for (RegExpTree* node : *alternative->nodes()) {
+      base::Vector<const base::uc16> literal = FindRequiredLiteral(node);
+      if (literal.length() > best.length()) best = literal;
+    }
+    return best;
+  }
+  if (RegExpQuantifier* quantifier = tree->AsQuantifier()) {
+    if (quantifier->min() == 0) return best;
+    return FindRequiredLiteral(quantifier->body());
+  }
+  if (RegExpCapture* capture = tree->AsCapture()) {
+    return FindRequiredLiteral(capture->body());
+  }
+  if (RegExpGroup* group = tree->AsGroup()) {
+    return FindRequiredLiteral(group->body());
+  }
+  if (RegExpLookaround* lookaround = tree->AsLookaround()) {
+    if (!lookaround->is_positive() ||
+        lookaround->type() != RegExpLookaround::LOOKAHEAD) {
+      return best;
+    }
+    return FindRequiredLiteral(lookaround->body());
+  }
+  return best;
+}
+
+template <typename SChar, typename PChar>
+bool ContainsLiteral(Isolate* isolate, base::Vector<const SChar> subject,
+                     base::Vector<const PChar> literal, int index) {
+  return SearchString(isolate, subject, literal, index) != -1;
+}
+
+// Returns false if the subject can't contain a match starting at or after
+// {index} because it lacks the required literal of the regexp.
+bool MayContainMatch(Isolate* isolate, Tagged<IrRegExpData> regexp_data,
+                     Tagged<String> subject, int index) {
+  Tagged<Object> maybe_literal = regexp_data->required_literal();
+  if (!IsString(maybe_literal)) return true;
+  Tagged<String> literal = Cast<String>(maybe_literal);
+  if (subject->length() - index < literal->length()) return false;
+
+  DisallowGarbageCollection no_gc;
+  String::FlatContent literal_content = literal->GetFlatContent(no_gc);
+  String::FlatContent subject_content = subject->GetFlatContent(no_gc);
+  DCHECK(literal_content.IsFlat());
+  DCHECK(subject_content.IsFlat());
+  if (literal_content.IsOneByte()) {
+    return subject_content.IsOneByte()
+               ? ContainsLiteral(isolate, subject_content.ToOneByteVector(),
+                                 literal_content.ToOneByteVector(), index)
+               : ContainsLiteral(isolate, subject_content.ToUC16Vector(),
+                                 literal_content.ToOneByteVector(), index);
+  }
+  return subject_content.IsOneByte()
+             ? ContainsLiteral(isolate, subject_content.ToOneByteVector(),
+                               literal_content.ToUC16Vector(), index)
+             : ContainsLiteral(isolate, subject_content.ToUC16Vector(),
+                               literal_content.ToUC16Vector(), index);
+}
+
+}  // namespace
+
 bool RegExpImpl::CompileIrregexp(Isolate* isolate,
                                  DirectHandle<IrRegExpData> re_data,
                                  Handle<String> sample_subject,
@@ -618,6 +710,20 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate,
   }
   re_data->set_backtrack_limit(backtrack_limit);
 
+  if (v8_flags.regexp_literal_prefilter && !IsIgnoreCase(flags) &&
+      !IsString(re_data->required_literal())) {
+    base::Vector<const base::uc16> literal =
+        FindRequiredLiteral(compile_data.tree);
+    if (!literal.empty()) {
+      Handle<String> literal_string;
+      if (isolate->factory()
+              ->NewStringFromTwoByte(literal, AllocationType::kOld)
+              .ToHandle(&literal_string)) {
+        re_data->set_required_literal(*literal_string);
+      }
+    }
+  }
+
   if (v8_flags.trace_regexp_tier_up) {
     PrintF("JSRegExp data object %p %s size: %d\n",
            reinterpret_cast<void*>(re_data->ptr()),
@@ -668,6 +774,11 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate,
   DCHECK_GE(output_size,
             JSRegExp::RegistersForCaptureCount(regexp_data->capture_count()));
 
+  if (v8_flags.regexp_literal_prefilter &&
+      !MayContainMatch(isolate, *regexp_data, *subject, index)) {
+    return RegExp::RE_FAILURE;
+  }
+
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
 
   if (!regexp_data->ShouldProduceBytecode()) {
@@ -1051,7 +1162,8 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
 
 RegExpGlobalCache::RegExpGlobalCache(Handle<RegExpData> regexp_data,
                                      Handle<String> subject, Isolate* isolate)
-    : register_array_(nullptr),
+    : can_batch_(true),
+      register_array_(nullptr),
       register_array_size_(0),
       regexp_data_(regexp_data),
       subject_(subject),
@@ -1075,7 +1187,7 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<RegExpData> regexp_data,
         // Global loop in interpreted regexp is not implemented.  We choose the
         // size of the offsets vector so that it can only store one match.
         register_array_size_ = registers_per_match_;
-        max_matches_ = 1;
+        can_batch_ = false;
       } else {
         register_array_size_ = std::max(
             {registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize});
@@ -1138,6 +1250,23 @@ int RegExpGlobalCache::AdvanceZeroLength(int last_index) {
   return last_index + 1;
 }
 
+void RegExpGlobalCache::GrowRegisterArray() {
+  const int new_size =
+      std::min(2 * register_array_size_, kMaxRegisterArraySize);
+  if (new_size < register_array_size_ + registers_per_match_) return;
+
+  // Keep the previous results so that LastSuccessfulMatch() stays valid if the
+  // next call fails.
+  int32_t* new_register_array = NewArray<int32_t>(new_size);
+  std::copy_n(register_array_, register_array_size_, new_register_array);
+  if (register_array_size_ > Isolate::kJSRegexpStaticOffsetsVectorSize) {
+    DeleteArray(register_array_);
+  }
+  register_array_ = new_register_array;
+  register_array_size_ = new_size;
+  max_matches_ = register_array_size_ / registers_per_match_;
+}
+
 int32_t* RegExpGlobalCache::FetchNext() {
   current_match_index_++;
 
@@ -1151,8 +1280,16 @@ int32_t* RegExpGlobalCache::FetchNext() {
 
     int32_t* last_match =
         &register_array_[(current_match_index_ - 1) * registers_per_match_];
+    int last_start_index = last_match[0];
     int last_end_index = last_match[1];
 
+    // The previous batch was full, so there are likely more matches to come.
+    // Note that the initial state looks like a full batch, too.
+    if (can_batch_ && last_start_index != -1 &&
+        register_array_size_ < kMaxRegisterArraySize) {
+      GrowRegisterArray();
+    }
+
     switch (regexp_data_->type_tag()) {
       case RegExpData::Type::ATOM:
         num_matches_ = RegExpImpl::AtomExecRaw(
@@ -1169,7 +1306,6 @@ int32_t* RegExpGlobalCache::FetchNext() {
         break;
       }
       case RegExpData::Type::IRREGEXP: {
-        int last_start_index = last_match[0];
         if (last_start_index == last_end_index) {
           // Zero-length match. Advance by one code point.
           last_end_index = AdvanceZeroLength(last_end_index);
@@ -195,8 +195,17 @@ class RegExpGlobalCache final {
   bool HasException() { return num_matches_ < 0; }
 
  private:
+  // The register array starts out small and grows geometrically every time a
+  // batch of results is completely filled, up to this many registers. This
+  // reduces the number of calls into the matcher when iterating over many
+  // matches in large subjects.
+  static constexpr int kMaxRegisterArraySize = 16 * KB;
+
   int AdvanceZeroLength(int last_index);
+  void GrowRegisterArray();
 
+  // Whether the matcher can produce several results per call.
+  bool can_batch_;
   int num_matches_;
   int max_matches_;
   int current_match_index_;
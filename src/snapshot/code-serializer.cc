@@ -5,6 +5,7 @@
 #include "src/snapshot/code-serializer.h"
 
 #include <memory>
+#include <unordered_set>
 
 #include "src/base/logging.h"
 #include "src/base/platform/elapsed-timer.h"
@@ -12,6 +13,7 @@
 #include "src/baseline/baseline-batch-compiler.h"
 #include "src/codegen/background-merge-task.h"
 #include "src/common/globals.h"
+#include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/handles/maybe-handles.h"
 #include "src/handles/persistent-handles.h"
 #include "src/heap/heap-inl.h"
@@ -23,6 +25,7 @@
 #include "src/objects/shared-function-info.h"
 #include "src/objects/slots.h"
 #include "src/objects/visitors.h"
+#include "src/parsing/scanner-character-streams.h"
 #include "src/snapshot/object-deserializer.h"
 #include "src/snapshot/snapshot-utils.h"
 #include "src/snapshot/snapshot.h"
@@ -69,6 +72,12 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   if (script->ContainsAsmModule()) return nullptr;
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+  // The compile hints are only kept in the cache with
+  // --code-cache-compile-hints; don't write out duplicates.
+  if (v8_flags.code_cache_compile_hints) {
+    script->CompactCompiledLazyFunctionPositions();
+  }
+
   // Serialize code object.
   DirectHandle<String> source(Cast<String>(script->source()), isolate);
   HandleScope scope(isolate);
@@ -334,6 +343,46 @@ class StressOffThreadDeserializeThread final : public base::Thread {
   CodeSerializer::OffThreadDeserializeData off_thread_data_;
 };
 
+// Posts background compile jobs for the functions that were lazily compiled
+// before the code cache was produced, but aren't compiled in the cache (e.g.
+// because their bytecode was flushed in the meantime), so that calling them
+// doesn't have to compile them on the main thread.
+void EnqueueCompileHintedFunctions(Isolate* isolate,
+                                   DirectHandle<Script> script) {
+  LazyCompileDispatcher* dispatcher = isolate->lazy_compile_dispatcher();
+  if (!v8_flags.code_cache_compile_hints || dispatcher == nullptr) return;
+  if (IsUndefined(script->compiled_lazy_function_positions(), isolate)) return;
+  // Background compile tasks can only access external sources.
+  Handle<String> source(Cast<String>(script->source()), isolate);
+  if (!IsExternalString(*source)) return;
+
+  std::unordered_set<int> positions;
+  {
+    DisallowGarbageCollection no_gc;
+    Tagged<ArrayList> list =
+        Cast<ArrayList>(script->compiled_lazy_function_positions());
+    for (int i = 0; i < list->length(); ++i) {
+      positions.insert(Smi::ToInt(list->get(i)));
+    }
+  }
+
+  SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+  for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    if (info->is_compiled() || !info->HasUncompiledData() ||
+        !positions.contains(info->StartPosition())) {
+      continue;
+    }
+    Handle<SharedFunctionInfo> shared_info(info, isolate);
+    if (dispatcher->IsEnqueued(shared_info)) continue;
+    std::unique_ptr<Utf16CharacterStream> character_stream(
+        ScannerStream::For(isolate, source, shared_info->StartPosition(),
+                           shared_info->EndPosition()));
+    dispatcher->Enqueue(isolate->main_thread_local_isolate(), shared_info,
+                        std::move(character_stream));
+  }
+}
+
 void FinalizeDeserialization(Isolate* isolate,
                              DirectHandle<SharedFunctionInfo> result,
                              const base::ElapsedTimer& timer,
@@ -357,6 +406,8 @@ void FinalizeDeserialization(Isolate* isolate,
     SetScriptFieldsFromDetails(isolate, *script, script_details, &no_gc);
   }
 
+  EnqueueCompileHintedFunctions(isolate, script);
+
   bool needs_source_positions = isolate->NeedsSourcePositions();
   if (!log_code_creation && !needs_source_positions) return;
 
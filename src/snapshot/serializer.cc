@@ -838,10 +838,14 @@ void Serializer::ObjectSerializer::Serialize(SlotType slot_type) {
     return;
   }
   if (InstanceTypeChecker::IsScript(instance_type)) {
-    // Clear cached line ends & compiled lazy function positions.
+    // Clear cached line ends & compiled lazy function positions. The latter
+    // are kept if they are used as compile hints when the code cache is
+    // consumed.
     Cast<Script>(object_)->set_line_ends(Smi::zero());
-    Cast<Script>(object_)->set_compiled_lazy_function_positions(
-        ReadOnlyRoots(isolate()).undefined_value());
+    if (!v8_flags.code_cache_compile_hints) {
+      Cast<Script>(object_)->set_compiled_lazy_function_positions(
+          ReadOnlyRoots(isolate()).undefined_value());
+    }
   }
 
 #if V8_ENABLE_WEBASSEMBLY
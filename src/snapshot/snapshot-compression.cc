@@ -4,7 +4,13 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "include/v8-platform.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/init/v8.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
@@ -12,12 +18,95 @@
 namespace v8 {
 namespace internal {
 
+// The compressed data consists of uint32_t-sized entries:
+// [0] uncompressed payload length
+// [1] number of chunks
+// ... compressed size of each chunk
+// ... compressed chunks
+// Every chunk but the last holds {kChunkSize} uncompressed bytes.
+constexpr uint32_t kUncompressedSizeOffset = 0;
+constexpr uint32_t kChunkCountOffset = kUncompressedSizeOffset + kUInt32Size;
+constexpr uint32_t kChunkSizesOffset = kChunkCountOffset + kUInt32Size;
+
 uint32_t GetUncompressedSize(const Bytef* compressed_data) {
   uint32_t size;
-  MemCopy(&size, compressed_data, sizeof(size));
+  MemCopy(&size, compressed_data + kUncompressedSizeOffset, sizeof(size));
   return size;
 }
 
+namespace {
+
+uint32_t ReadUInt32(const uint8_t* data, uint32_t offset) {
+  uint32_t value;
+  MemCopy(&value, data + offset, sizeof(value));
+  return value;
+}
+
+void WriteUInt32(uint8_t* data, uint32_t offset, uint32_t value) {
+  MemCopy(data + offset, &value, sizeof(value));
+}
+
+// Decompresses the chunks of a compressed snapshot into {output}. Chunks are
+// independent of each other, so any number of threads can work on them.
+class DecompressChunksTask final : public JobTask {
+ public:
+  DecompressChunksTask(base::Vector<const uint8_t> compressed_data,
+                       uint8_t* output)
+      : input_(compressed_data.begin()),
+        output_(output),
+        uncompressed_size_(GetUncompressedSize(input_)),
+        chunk_count_(ReadUInt32(input_, kChunkCountOffset)),
+        chunk_offsets_(chunk_count_ + 1) {
+    // Compute where every chunk starts in the compressed data.
+    chunk_offsets_[0] = kChunkSizesOffset + chunk_count_ * kUInt32Size;
+    for (uint32_t i = 0; i < chunk_count_; ++i) {
+      chunk_offsets_[i + 1] =
+          chunk_offsets_[i] +
+          ReadUInt32(input_, kChunkSizesOffset + i * kUInt32Size);
+    }
+    CHECK_EQ(chunk_offsets_[chunk_count_], compressed_data.size());
+  }
+
+  uint32_t chunk_count() const { return chunk_count_; }
+
+  void Run(JobDelegate* delegate) override {
+    do {
+      uint32_t chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= chunk_count_) return;
+      DecompressChunk(chunk);
+    } while (!delegate->ShouldYield());
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    uint32_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    return next_chunk < chunk_count_ ? chunk_count_ - next_chunk : 0;
+  }
+
+  void DecompressChunk(uint32_t chunk) {
+    const uint32_t output_offset = chunk * SnapshotCompression::kChunkSize;
+    uLongf uncompressed_size = std::min(SnapshotCompression::kChunkSize,
+                                        uncompressed_size_ - output_offset);
+    const uLongf expected_size = uncompressed_size;
+    CHECK_EQ(zlib_internal::UncompressHelper(
+                 zlib_internal::ZRAW, output_ + output_offset,
+                 &uncompressed_size, input_ + chunk_offsets_[chunk],
+                 static_cast<uLong>(chunk_offsets_[chunk + 1] -
+                                    chunk_offsets_[chunk])),
+             Z_OK);
+    CHECK_EQ(uncompressed_size, expected_size);
+  }
+
+ private:
+  const uint8_t* const input_;
+  uint8_t* const output_;
+  const uint32_t uncompressed_size_;
+  const uint32_t chunk_count_;
+  std::vector<size_t> chunk_offsets_;
+  std::atomic<uint32_t> next_chunk_{0};
+};
+
+}  // namespace
+
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
   SnapshotData snapshot_data;
@@ -25,40 +114,53 @@ SnapshotData SnapshotCompression::Compress(
   if (v8_flags.profile_deserialization) timer.Start();
 
   static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
+  const uint8_t* input = uncompressed_data->RawData().begin();
   uint32_t payload_length =
       static_cast<uint32_t>(uncompressed_data->RawData().size());
-
-  uLongf compressed_data_size = compressBound(input_size);
+  uint32_t chunk_count = (payload_length + kChunkSize - 1) / kChunkSize;
 
   // Allocating >= the final amount we will need.
+  const uint32_t header_size = kChunkSizesOffset + chunk_count * kUInt32Size;
+  uLongf max_compressed_size = 0;
+  for (uint32_t offset = 0; offset < payload_length; offset += kChunkSize) {
+    max_compressed_size +=
+        compressBound(std::min(kChunkSize, payload_length - offset));
+  }
   snapshot_data.AllocateData(
-      static_cast<uint32_t>(sizeof(payload_length) + compressed_data_size));
+      static_cast<uint32_t>(header_size + max_compressed_size));
 
   uint8_t* compressed_data =
       const_cast<uint8_t*>(snapshot_data.RawData().begin());
   // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually store the uncompressed size.
-  MemCopy(compressed_data, &payload_length, sizeof(payload_length));
-
-  CHECK_EQ(
-      zlib_internal::CompressHelper(
-          zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
-          &compressed_data_size,
-          reinterpret_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-          input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
-      Z_OK);
+  // manually store the uncompressed sizes.
+  WriteUInt32(compressed_data, kUncompressedSizeOffset, payload_length);
+  WriteUInt32(compressed_data, kChunkCountOffset, chunk_count);
+
+  uint32_t compressed_size = header_size;
+  for (uint32_t chunk = 0; chunk < chunk_count; ++chunk) {
+    const uint32_t offset = chunk * kChunkSize;
+    const uLongf input_size = std::min(kChunkSize, payload_length - offset);
+    uLongf compressed_chunk_size = compressBound(input_size);
+    CHECK_EQ(zlib_internal::CompressHelper(
+                 zlib_internal::ZRAW, compressed_data + compressed_size,
+                 &compressed_chunk_size,
+                 reinterpret_cast<const Bytef*>(input + offset), input_size,
+                 Z_DEFAULT_COMPRESSION, nullptr, nullptr),
+             Z_OK);
+    WriteUInt32(compressed_data, kChunkSizesOffset + chunk * kUInt32Size,
+                static_cast<uint32_t>(compressed_chunk_size));
+    compressed_size += static_cast<uint32_t>(compressed_chunk_size);
+  }
 
   // Reallocating to exactly the size we need.
-  snapshot_data.Resize(static_cast<uint32_t>(compressed_data_size) +
-                       sizeof(payload_length));
+  snapshot_data.Resize(compressed_size);
   DCHECK_EQ(payload_length,
             GetUncompressedSize(snapshot_data.RawData().begin()));
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Compressing %d bytes took %0.3f ms]\n", payload_length, ms);
+    PrintF("[Compressing %d bytes in %d chunks took %0.3f ms]\n",
+           payload_length, chunk_count, ms);
   }
   return snapshot_data;
 }
@@ -69,29 +171,32 @@ SnapshotData SnapshotCompression::Decompress(
   base::ElapsedTimer timer;
   if (v8_flags.profile_deserialization) timer.Start();
 
-  const Bytef* input_bytef =
-      reinterpret_cast<const Bytef*>(compressed_data.begin());
-
   // Since we are doing raw compression (no zlib or gzip headers), we need to
   // manually retrieve the uncompressed size.
-  uint32_t uncompressed_payload_length = GetUncompressedSize(input_bytef);
-  input_bytef += sizeof(uncompressed_payload_length);
-
+  uint32_t uncompressed_payload_length =
+      GetUncompressedSize(compressed_data.begin());
   snapshot_data.AllocateData(uncompressed_payload_length);
 
-  uLongf uncompressed_size = uncompressed_payload_length;
-  CHECK_EQ(zlib_internal::UncompressHelper(
-               zlib_internal::ZRAW,
-               const_cast<Bytef*>(snapshot_data.RawData().begin()),
-               &uncompressed_size, input_bytef,
-               static_cast<uLong>(compressed_data.size() -
-                                  sizeof(uncompressed_payload_length))),
-           Z_OK);
+  auto task = std::make_unique<DecompressChunksTask>(
+      compressed_data, const_cast<uint8_t*>(snapshot_data.RawData().begin()));
+  const uint32_t chunk_count = task->chunk_count();
+  if (chunk_count > 1 && v8_flags.concurrent_snapshot_decompression &&
+      !v8_flags.single_threaded) {
+    // The joining thread takes part in the decompression, so this is never
+    // slower than decompressing on the main thread only.
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking, std::move(task))
+        ->Join();
+  } else {
+    for (uint32_t chunk = 0; chunk < chunk_count; ++chunk) {
+      task->DecompressChunk(chunk);
+    }
+  }
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Decompressing %d bytes took %0.3f ms]\n",
-           uncompressed_payload_length, ms);
+    PrintF("[Decompressing %d bytes in %d chunks took %0.3f ms]\n",
+           uncompressed_payload_length, chunk_count, ms);
   }
   return snapshot_data;
 }
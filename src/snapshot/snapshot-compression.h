@@ -13,6 +13,10 @@ namespace internal {
 
 class SnapshotCompression : public AllStatic {
  public:
+  // The payload is compressed in independent chunks of this many bytes, which
+  // are decompressed in parallel.
+  static constexpr uint32_t kChunkSize = 256 * KB;
+
   V8_EXPORT_PRIVATE static SnapshotData Compress(
       const SnapshotData* uncompressed_data);
   V8_EXPORT_PRIVATE static SnapshotData Decompress(
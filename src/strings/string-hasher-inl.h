@@ -10,6 +10,7 @@
 // Comment inserted to prevent header reordering.
 #include <type_traits>
 
+#include "src/base/bits.h"
 #include "src/objects/name-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/strings/char-predicates-inl.h"
@@ -36,6 +37,71 @@ uint32_t StringHasher::GetHashCore(uint32_t running_hash) {
   return running_hash;
 }
 
+namespace detail {
+
+// Multiplies {a} and {b} to 128 bits and folds the result to 64 bits, as in
+// wyhash.
+V8_INLINE uint64_t HashMix(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+  __uint128_t product = static_cast<__uint128_t>(a) * b;
+  return static_cast<uint64_t>(product) ^
+         static_cast<uint64_t>(product >> 64);
+#else
+  return (a * b) ^ base::bits::UnsignedMulHigh64(a, b);
+#endif
+}
+
+// Reads {count} (at most four) characters into a word, with character i in
+// bits [16 * i, 16 * i + 16).
+template <typename uchar>
+V8_INLINE uint64_t ReadHashChars(const uchar* chars, uint32_t count) {
+  uint64_t word = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    word |= static_cast<uint64_t>(chars[i]) << (16 * i);
+  }
+  return word;
+}
+
+template <typename uchar>
+V8_INLINE uint64_t ReadFourHashChars(const uchar* chars) {
+  return static_cast<uint64_t>(chars[0]) |
+         static_cast<uint64_t>(chars[1]) << 16 |
+         static_cast<uint64_t>(chars[2]) << 32 |
+         static_cast<uint64_t>(chars[3]) << 48;
+}
+
+constexpr uint64_t kHashSecret0 = 0x2d358dccaa6c78a5;
+constexpr uint64_t kHashSecret1 = 0x8bb84b93962eacc9;
+constexpr uint64_t kHashSecret2 = 0x4b33a62ed433d4a3;
+
+}  // namespace detail
+
+template <typename uchar>
+uint32_t StringHasher::HashChars(const uchar* chars, uint32_t length,
+                                 uint64_t seed) {
+  uint64_t state = seed ^ detail::HashMix(seed ^ detail::kHashSecret0,
+                                          detail::kHashSecret1);
+  uint32_t i = 0;
+  for (; length - i >= 8; i += 8) {
+    uint64_t a = detail::ReadFourHashChars(chars + i);
+    uint64_t b = detail::ReadFourHashChars(chars + i + 4);
+    state = detail::HashMix(a ^ detail::kHashSecret1, b ^ state);
+  }
+  uint64_t a = 0;
+  if (length - i >= 4) {
+    a = detail::ReadFourHashChars(chars + i);
+    i += 4;
+  }
+  uint64_t b = detail::ReadHashChars(chars + i, length - i);
+  state = detail::HashMix(a ^ detail::kHashSecret1 ^ length, b ^ state);
+  state = detail::HashMix(state ^ detail::kHashSecret2, detail::kHashSecret0);
+
+  uint32_t hash = static_cast<uint32_t>(state ^ (state >> 32));
+  // Ensure that the hash is kZeroHash, if the computed value is 0.
+  if ((hash & String::HashBits::kMax) == 0) hash |= kZeroHash;
+  return hash;
+}
+
 uint32_t StringHasher::GetTrivialHash(uint32_t length) {
   DCHECK_GT(length, String::kMaxHashCalcLength);
   // The hash of a large string is simply computed from the length.
@@ -79,18 +145,15 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw,
         // Perform a regular hash computation, and additionally check
         // if there are non-digit characters.
         String::HashFieldType type = String::HashFieldType::kIntegerIndex;
-        uint32_t running_hash = static_cast<uint32_t>(seed);
         uint64_t index_big = 0;
-        const uchar* end = &chars[length];
-        while (chars != end) {
-          if (type == String::HashFieldType::kIntegerIndex &&
-              !TryAddIntegerIndexChar(&index_big, *chars)) {
+        for (uint32_t i = 0; i < length; i++) {
+          if (!TryAddIntegerIndexChar(&index_big, chars[i])) {
             type = String::HashFieldType::kHash;
+            break;
           }
-          running_hash = AddCharacterCore(running_hash, *chars++);
         }
-        uint32_t hash =
-            String::CreateHashFieldValue(GetHashCore(running_hash), type);
+        uint32_t hash = String::CreateHashFieldValue(
+            HashChars(chars, length, seed), type);
         if (Name::ContainsCachedArrayIndex(hash)) {
           // The hash accidentally looks like a cached index. Fix that by
           // setting a bit that looks like a longer-than-cacheable string
@@ -111,13 +174,7 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw,
   }
 
   // Non-index hash.
-  uint32_t running_hash = static_cast<uint32_t>(seed);
-  const uchar* end = &chars[length];
-  while (chars != end) {
-    running_hash = AddCharacterCore(running_hash, *chars++);
-  }
-
-  return String::CreateHashFieldValue(GetHashCore(running_hash),
+  return String::CreateHashFieldValue(HashChars(chars, length, seed),
                                       String::HashFieldType::kHash);
 }
 
@@ -35,11 +35,21 @@ class V8_EXPORT_PRIVATE StringHasher final {
   // use 27 instead.
   static const int kZeroHash = 27;
 
-  // Reusable parts of the hashing algorithm.
+  // Steps of Jenkins' one-at-a-time hash, for incrementally hashing data that
+  // doesn't have to agree with string hashes.
   V8_INLINE static uint32_t AddCharacterCore(uint32_t running_hash, uint16_t c);
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
 
   static inline uint32_t GetTrivialHash(uint32_t length);
+
+ private:
+  // Hashes the characters of a string four at a time. Characters are read as
+  // 16-bit values, so one- and two-byte representations of the same string get
+  // the same hash. The result is never zero in the bits used by the hash
+  // field.
+  template <typename uchar>
+  V8_INLINE static uint32_t HashChars(const uchar* chars, uint32_t length,
+                                      uint64_t seed);
 };
 
 // Useful for std containers that require something ()'able.
@@ -0,0 +1,206 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-search.h"
+
+#include "src/base/bits.h"
+
+#if (defined(__SSE2__) ||  \
+     (defined(_MSC_VER) && \
+      (defined(_M_X64) || (defined(_M_IX86) && _M_IX86_FP >= 2))))
+#define V8_STRING_SEARCH_SSE2 1
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+// As in simd.cc, Neon is only used on 64-bit ARM, where it is guaranteed to be
+// available.
+#define V8_STRING_SEARCH_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Compares the inner characters of {pattern} to {subject}. The first and last
+// characters have already been checked by the caller.
+template <typename PatternChar, typename SubjectChar>
+inline bool InnerCharactersMatch(base::Vector<const PatternChar> pattern,
+                                 const SubjectChar* subject) {
+  for (int j = 1; j < pattern.length() - 1; ++j) {
+    if (pattern[j] != subject[j]) return false;
+  }
+  return true;
+}
+
+template <typename PatternChar, typename SubjectChar>
+int ScalarFirstLastCharacterFilterSearch(
+    base::Vector<const PatternChar> pattern,
+    base::Vector<const SubjectChar> subject, int index) {
+  const int pattern_length = pattern.length();
+  const PatternChar first = pattern[0];
+  const PatternChar last = pattern[pattern_length - 1];
+  for (int i = index, n = subject.length() - pattern_length; i <= n; i++) {
+    if (subject[i] == first && subject[i + pattern_length - 1] == last &&
+        InnerCharactersMatch(pattern, subject.begin() + i)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+#if defined(V8_STRING_SEARCH_SSE2) || defined(V8_STRING_SEARCH_NEON)
+
+// FilterVector<SubjectChar>::Mask returns a mask with {kBitsPerLane} bits set
+// for every lane of the vector starting at {subject} whose character is equal
+// to the first pattern character, and whose character {last_offset} positions
+// later is equal to the last pattern character.
+template <typename SubjectChar>
+struct FilterVector;
+
+#if defined(V8_STRING_SEARCH_SSE2)
+
+template <>
+struct FilterVector<uint8_t> {
+  static constexpr int kLanes = 16;
+  static constexpr int kBitsPerLane = 1;
+  FilterVector(uint8_t first, uint8_t last)
+      : first_(_mm_set1_epi8(static_cast<char>(first))),
+        last_(_mm_set1_epi8(static_cast<char>(last))) {}
+  uint64_t Mask(const uint8_t* subject, int last_offset) const {
+    __m128i block_first =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(subject));
+    __m128i block_last = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(subject + last_offset));
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first_, block_first),
+                                        _mm_cmpeq_epi8(last_, block_last))));
+  }
+  __m128i first_;
+  __m128i last_;
+};
+
+template <>
+struct FilterVector<base::uc16> {
+  static constexpr int kLanes = 8;
+  static constexpr int kBitsPerLane = 2;
+  FilterVector(base::uc16 first, base::uc16 last)
+      : first_(_mm_set1_epi16(static_cast<int16_t>(first))),
+        last_(_mm_set1_epi16(static_cast<int16_t>(last))) {}
+  uint64_t Mask(const base::uc16* subject, int last_offset) const {
+    __m128i block_first =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(subject));
+    __m128i block_last = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(subject + last_offset));
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi16(first_, block_first),
+                                        _mm_cmpeq_epi16(last_, block_last))));
+  }
+  __m128i first_;
+  __m128i last_;
+};
+
+#elif defined(V8_STRING_SEARCH_NEON)
+
+// Neon has no movemask; narrowing each 16-bit lane of the comparison result
+// by 4 bits yields a 64-bit mask with 4 bits per byte.
+template <>
+struct FilterVector<uint8_t> {
+  static constexpr int kLanes = 16;
+  static constexpr int kBitsPerLane = 4;
+  FilterVector(uint8_t first, uint8_t last)
+      : first_(vdupq_n_u8(first)), last_(vdupq_n_u8(last)) {}
+  uint64_t Mask(const uint8_t* subject, int last_offset) const {
+    uint8x16_t eq = vandq_u8(vceqq_u8(first_, vld1q_u8(subject)),
+                             vceqq_u8(last_, vld1q_u8(subject + last_offset)));
+    return vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+  }
+  uint8x16_t first_;
+  uint8x16_t last_;
+};
+
+template <>
+struct FilterVector<base::uc16> {
+  static constexpr int kLanes = 8;
+  static constexpr int kBitsPerLane = 8;
+  FilterVector(base::uc16 first, base::uc16 last)
+      : first_(vdupq_n_u16(first)), last_(vdupq_n_u16(last)) {}
+  uint64_t Mask(const base::uc16* subject, int last_offset) const {
+    uint16x8_t eq =
+        vandq_u16(vceqq_u16(first_, vld1q_u16(subject)),
+                  vceqq_u16(last_, vld1q_u16(subject + last_offset)));
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(eq, 4)), 0);
+  }
+  uint16x8_t first_;
+  uint16x8_t last_;
+};
+
+#endif
+
+template <typename PatternChar, typename SubjectChar>
+int VectorFirstLastCharacterFilterSearch(
+    base::Vector<const PatternChar> pattern,
+    base::Vector<const SubjectChar> subject, int index) {
+  using Filter = FilterVector<SubjectChar>;
+  constexpr uint64_t kLaneMask = (uint64_t{1} << Filter::kBitsPerLane) - 1;
+  const int pattern_length = pattern.length();
+  const int last_offset = pattern_length - 1;
+  // The caller guarantees that pattern characters fit into SubjectChar.
+  const Filter filter(static_cast<SubjectChar>(pattern[0]),
+                      static_cast<SubjectChar>(pattern[last_offset]));
+  const SubjectChar* subject_start = subject.begin();
+  // The last index at which a whole vector of candidate positions can be
+  // checked without reading past the end of the subject.
+  const int last_vector_index =
+      subject.length() - pattern_length - (Filter::kLanes - 1);
+  int i = index;
+  for (; i <= last_vector_index; i += Filter::kLanes) {
+    uint64_t mask = filter.Mask(subject_start + i, last_offset);
+    while (mask != 0) {
+      int lane = base::bits::CountTrailingZeros(mask) / Filter::kBitsPerLane;
+      if (InnerCharactersMatch(pattern, subject_start + i + lane)) {
+        return i + lane;
+      }
+      mask &= ~(kLaneMask << (lane * Filter::kBitsPerLane));
+    }
+  }
+  return ScalarFirstLastCharacterFilterSearch(pattern, subject, i);
+}
+
+#endif  // defined(V8_STRING_SEARCH_SSE2) || defined(V8_STRING_SEARCH_NEON)
+
+}  // namespace
+
+template <typename PatternChar, typename SubjectChar>
+int FirstLastCharacterFilterSearch(base::Vector<const PatternChar> pattern,
+                                   base::Vector<const SubjectChar> subject,
+                                   int index) {
+  DCHECK_GE(pattern.length(), 2);
+#if defined(V8_STRING_SEARCH_SSE2) || defined(V8_STRING_SEARCH_NEON)
+  return VectorFirstLastCharacterFilterSearch(pattern, subject, index);
+#else
+  return ScalarFirstLastCharacterFilterSearch(pattern, subject, index);
+#endif
+}
+
+template EXPORT_TEMPLATE_DEFINE(V8_EXPORT_PRIVATE) int
+    FirstLastCharacterFilterSearch(base::Vector<const uint8_t> pattern,
+                                   base::Vector<const uint8_t> subject,
+                                   int index);
+template EXPORT_TEMPLATE_DEFINE(V8_EXPORT_PRIVATE) int
+    FirstLastCharacterFilterSearch(base::Vector<const uint8_t> pattern,
+                                   base::Vector<const base::uc16> subject,
+                                   int index);
+template EXPORT_TEMPLATE_DEFINE(V8_EXPORT_PRIVATE) int
+    FirstLastCharacterFilterSearch(base::Vector<const base::uc16> pattern,
+                                   base::Vector<const uint8_t> subject,
+                                   int index);
+template EXPORT_TEMPLATE_DEFINE(V8_EXPORT_PRIVATE) int
+    FirstLastCharacterFilterSearch(base::Vector<const base::uc16> pattern,
+                                   base::Vector<const base::uc16> subject,
+                                   int index);
+
+}  // namespace internal
+}  // namespace v8
@@ -5,6 +5,7 @@
 #ifndef V8_STRINGS_STRING_SEARCH_H_
 #define V8_STRINGS_STRING_SEARCH_H_
 
+#include "src/base/export-template.h"
 #include "src/base/strings.h"
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
@@ -42,6 +43,11 @@ class StringSearchBase {
   // to compensate for the algorithmic overhead compared to simple brute force.
   static const int kBMMinPatternLength = 7;
 
+  // Patterns up to this length are searched by filtering candidate positions
+  // on their first and last character, see FirstLastCharacterFilterSearch.
+  // Longer patterns benefit more from the Boyer-Moore skip tables.
+  static const int kFilterMaxPatternLength = 32;
+
   static inline bool IsOneByteString(base::Vector<const uint8_t> string) {
     return true;
   }
@@ -67,12 +73,12 @@ class StringSearch : private StringSearchBase {
       }
     }
     int pattern_length = pattern_.length();
-    if (pattern_length < kBMMinPatternLength) {
-      if (pattern_length == 1) {
-        strategy_ = &SingleCharSearch;
-        return;
-      }
-      strategy_ = &LinearSearch;
+    if (pattern_length == 1) {
+      strategy_ = &SingleCharSearch;
+      return;
+    }
+    if (pattern_length <= kFilterMaxPatternLength) {
+      strategy_ = &FilterSearch;
       return;
     }
     strategy_ = &InitialSearch;
@@ -106,7 +112,7 @@ class StringSearch : private StringSearchBase {
                               base::Vector<const SubjectChar> subject,
                               int start_index);
 
-  static int LinearSearch(StringSearch<PatternChar, SubjectChar>* search,
+  static int FilterSearch(StringSearch<PatternChar, SubjectChar>* search,
                           base::Vector<const SubjectChar> subject,
                           int start_index);
 
@@ -247,46 +253,47 @@ int StringSearch<PatternChar, SubjectChar>::SingleCharSearch(
 }
 
 //---------------------------------------------------------------------
-// Linear Search Strategy
+// First and Last Character Filter Search Strategy
 //---------------------------------------------------------------------
 
+// Searches {subject} for {pattern}, which is between 2 and
+// kFilterMaxPatternLength characters long, starting at {index}. Candidate
+// positions are found by comparing the first and last character of the
+// pattern against a whole SIMD vector of subject positions at a time; only
+// positions where both match are compared in full. Defined in
+// string-search.cc for one- and two-byte patterns and subjects. Pattern
+// characters must fit into SubjectChar.
 template <typename PatternChar, typename SubjectChar>
-inline bool CharCompare(const PatternChar* pattern, const SubjectChar* subject,
-                        int length) {
-  DCHECK_GT(length, 0);
-  int pos = 0;
-  do {
-    if (pattern[pos] != subject[pos]) {
-      return false;
-    }
-    pos++;
-  } while (pos < length);
-  return true;
-}
+EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE)
+int FirstLastCharacterFilterSearch(
+    base::Vector<const PatternChar> pattern,
+    base::Vector<const SubjectChar> subject, int index);
+
+// Explicit instantiation declarations.
+extern template EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE) int
+    FirstLastCharacterFilterSearch(base::Vector<const uint8_t> pattern,
+                                   base::Vector<const uint8_t> subject,
+                                   int index);
+extern template EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE) int
+    FirstLastCharacterFilterSearch(base::Vector<const uint8_t> pattern,
+                                   base::Vector<const base::uc16> subject,
+                                   int index);
+extern template EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE) int
+    FirstLastCharacterFilterSearch(base::Vector<const base::uc16> pattern,
+                                   base::Vector<const uint8_t> subject,
+                                   int index);
+extern template EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE) int
+    FirstLastCharacterFilterSearch(base::Vector<const base::uc16> pattern,
+                                   base::Vector<const base::uc16> subject,
+                                   int index);
 
-// Simple linear search for short patterns. Never bails out.
 template <typename PatternChar, typename SubjectChar>
-int StringSearch<PatternChar, SubjectChar>::LinearSearch(
+int StringSearch<PatternChar, SubjectChar>::FilterSearch(
     StringSearch<PatternChar, SubjectChar>* search,
     base::Vector<const SubjectChar> subject, int index) {
-  base::Vector<const PatternChar> pattern = search->pattern_;
-  DCHECK_GT(pattern.length(), 1);
-  int pattern_length = pattern.length();
-  int i = index;
-  int n = subject.length() - pattern_length;
-  while (i <= n) {
-    i = FindFirstCharacter(pattern, subject, i);
-    if (i == -1) return -1;
-    DCHECK_LE(i, n);
-    i++;
-    // Loop extracted to separate function to allow using return to do
-    // a deeper break.
-    if (CharCompare(pattern.begin() + 1, subject.begin() + i,
-                    pattern_length - 1)) {
-      return i - 1;
-    }
-  }
-  return -1;
+  DCHECK_GT(search->pattern_.length(), 1);
+  DCHECK_LE(search->pattern_.length(), kFilterMaxPatternLength);
+  return FirstLastCharacterFilterSearch(search->pattern_, subject, index);
 }
 
 //---------------------------------------------------------------------
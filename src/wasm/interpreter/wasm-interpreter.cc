@@ -6384,14 +6384,18 @@ size_t WasmBytecodeGenerator::Simd128Hash::operator()(
 // Look if the slot that hold the value at {stack_index} is being shared with
 // other slots. This can happen if there are multiple load.get operations that
 // copy from the same local.
-bool WasmBytecodeGenerator::HasSharedSlot(uint32_t stack_index) const {
+bool WasmBytecodeGenerator::HasSharedSlot(
+    uint32_t stack_index, uint32_t ignored_top_entries) const {
+  DCHECK_LE(ignored_top_entries, stack_.size());
   // Only consider stack entries added in the current block.
   // We don't need to consider ancestor blocks because if a block has a
   // non-empty signature we always pass arguments and results into separate
   // slots, emitting CopySlot operations.
   uint32_t start_slot_index = blocks_[current_block_index_].stack_size_;
+  uint32_t end_slot_index =
+      static_cast<uint32_t>(stack_.size()) - ignored_top_entries;
 
-  for (uint32_t i = start_slot_index; i < stack_.size(); i++) {
+  for (uint32_t i = start_slot_index; i < end_slot_index; i++) {
     if (stack_[i] == stack_[stack_index]) {
       return true;
     }
@@ -11169,6 +11173,39 @@ bool WasmBytecodeGenerator::EncodeSuperInstruction(
       STORE_CASE(F64StoreMem, Float64, uint64_t, kFloat64, F64);
 #undef STORE_CASE
 
+      default:
+        return false;
+    }
+  } else if (next_instr.orig == kExprLocalSet) {
+    // An arithmetic binop followed by a local.set writes its result directly
+    // into the slot of the local, instead of pushing it into a new slot that
+    // then needs to be copied by a separate CopySlot instruction.
+    // The handler pops its operands before writing the result, so the operands
+    // can safely share the slot of the local (as in `x = x + 1`).
+    uint32_t to_stack_index = next_instr.optional.index;
+    uint32_t operands_on_stack = reg_mode == RegMode::kNoReg ? 2 : 1;
+
+    switch (curr_instr.orig) {
+#define BINOP_CASE(name, ctype, reg, op, type)                \
+  case kExpr##name: {                                         \
+    if (HasSharedSlot(to_stack_index, operands_on_stack)) {   \
+      return false;                                           \
+    }                                                         \
+    if (reg_mode == RegMode::kNoReg) {                        \
+      EMIT_INSTR_HANDLER(s2s_##name);                         \
+      type##Pop();                                            \
+      type##Pop();                                            \
+    } else {                                                  \
+      EMIT_INSTR_HANDLER(r2s_##name);                         \
+      type##Pop();                                            \
+    }                                                         \
+    EmitI32Const(slots_[stack_[to_stack_index]].slot_offset); \
+    reg_mode = RegMode::kNoReg;                               \
+    return true;                                              \
+  }
+      FOREACH_ARITHMETIC_BINOP(BINOP_CASE)
+#undef BINOP_CASE
+
       default:
         return false;
     }
@@ -1620,7 +1620,11 @@ class WasmBytecodeGenerator {
   void PatchLoopJumpInstructions();
   void RestoreIfElseParams(uint32_t if_block_index);
 
-  bool HasSharedSlot(uint32_t stack_index) const;
+  // Returns true if the slot of the stack entry {stack_index} is shared with
+  // another stack entry, ignoring the {ignored_top_entries} entries on top of
+  // the stack (which are about to be popped).
+  bool HasSharedSlot(uint32_t stack_index,
+                     uint32_t ignored_top_entries = 0) const;
   bool FindSharedSlot(uint32_t stack_index, uint32_t* new_slot_index);
 
   inline const FunctionSig* GetFunctionSignature(uint32_t function_index) const;
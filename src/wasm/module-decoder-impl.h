@@ -549,7 +549,11 @@ class ModuleDecoderImpl : public Decoder {
     }
   }
 
-  TypeDefinition consume_base_type_definition() {
+  // {struct_reorderable_from} is the index of the first struct field whose
+  // position in the object layout is not fixed by subtyping, see
+  // {StructTypeBase::InitializeOffsets}.
+  TypeDefinition consume_base_type_definition(
+      uint32_t struct_reorderable_from = 0) {
     const bool is_final = true;
     bool shared = false;
     uint8_t kind = consume_u8(" kind", tracer_);
@@ -573,7 +577,8 @@ class ModuleDecoderImpl : public Decoder {
       }
       case kWasmStructTypeCode: {
         module_->is_wasm_gc = true;
-        const StructType* type = consume_struct(&module_->signature_zone);
+        const StructType* type = consume_struct(&module_->signature_zone,
+                                                struct_reorderable_from);
         return {type, kNoSuperType, is_final, shared};
       }
       case kWasmArrayTypeCode: {
@@ -613,7 +618,20 @@ class ModuleDecoderImpl : public Decoder {
           tracer_->NextLine();
         }
       }
-      TypeDefinition type = consume_base_type_definition();
+      // Only final types may lay out their own fields freely; the fields
+      // inherited from the supertype have to keep their offsets.
+      uint32_t struct_reorderable_from = kMaxUInt32;
+      if (is_final) {
+        struct_reorderable_from = 0;
+        if (supertype != kNoSuperType.index) {
+          const TypeDefinition& super = module_->types[supertype];
+          if (super.kind == TypeDefinition::kStruct && super.struct_type) {
+            struct_reorderable_from = super.struct_type->field_count();
+          }
+        }
+      }
+      TypeDefinition type =
+          consume_base_type_definition(struct_reorderable_from);
       type.supertype = ModuleTypeIndex{supertype};
       type.is_final = is_final;
       return type;
@@ -2275,7 +2293,7 @@ class ModuleDecoderImpl : public Decoder {
     return zone->New<FunctionSig>(return_count, param_count, sig_storage);
   }
 
-  const StructType* consume_struct(Zone* zone) {
+  const StructType* consume_struct(Zone* zone, uint32_t reorderable_from) {
     uint32_t field_count =
         consume_count(", field count", kV8MaxWasmStructFields);
     if (failed()) return nullptr;
@@ -2290,7 +2308,7 @@ class ModuleDecoderImpl : public Decoder {
     uint32_t* offsets = zone->AllocateArray<uint32_t>(field_count);
     StructType* result =
         zone->New<StructType>(field_count, offsets, fields, mutabilities);
-    result->InitializeOffsets();
+    result->InitializeOffsets(reorderable_from);
     return result;
   }
 
@@ -1639,6 +1639,49 @@ bool MaybeMarkError(ValueOrError value, ErrorThrower* thrower) {
   }
   return false;
 }
+
+bool IsZero(const uint8_t* start, size_t size) {
+  const uint8_t* end = start + size;
+  for (; start < end && !IsAligned(reinterpret_cast<Address>(start),
+                                   sizeof(uint64_t));
+       ++start) {
+    if (*start != 0) return false;
+  }
+  for (; start + sizeof(uint64_t) <= end; start += sizeof(uint64_t)) {
+    if (*reinterpret_cast<const uint64_t*>(start) != 0) return false;
+  }
+  for (; start < end; ++start) {
+    if (*start != 0) return false;
+  }
+  return true;
+}
+
+// Copies {src} to {dst}, which must be zero-initialized. Whole pages of
+// {dst} for which {src} contains only zeros are not written, so that they
+// don't need to be committed by the OS until the program writes to them.
+// Large data segments (e.g. embedded assets or zero-initialized static data)
+// often contain long runs of zeros.
+void CopyToZeroInitializedMemory(uint8_t* dst,
+                                 base::Vector<const uint8_t> src) {
+  const size_t page_size = CommitPageSize();
+  const uint8_t* src_ptr = src.begin();
+  size_t remaining = src.size();
+  // Copy up to the first page boundary of {dst}.
+  size_t head = std::min(
+      remaining, RoundUp(reinterpret_cast<Address>(dst), page_size) -
+                     reinterpret_cast<Address>(dst));
+  std::memcpy(dst, src_ptr, head);
+  dst += head;
+  src_ptr += head;
+  remaining -= head;
+  while (remaining > 0) {
+    size_t chunk = std::min(remaining, page_size);
+    if (!IsZero(src_ptr, chunk)) std::memcpy(dst, src_ptr, chunk);
+    dst += chunk;
+    src_ptr += chunk;
+    remaining -= chunk;
+  }
+}
 }  // namespace
 
 // Look up an import value in the {ffi_} object specifically for linking an
@@ -1695,6 +1738,10 @@ void InstanceBuilder::LoadDataSegments(
     Handle<WasmTrustedInstanceData> shared_trusted_instance_data) {
   base::Vector<const uint8_t> wire_bytes =
       module_object_->native_module()->wire_bytes();
+  // Memories which are not imported were just allocated, and are hence known
+  // to be zero-initialized. For each memory, we track the end of the region
+  // written by previous segments; everything above is still all zeros.
+  std::vector<size_t> initialized_end(module_->memories.size(), 0);
   for (const WasmDataSegment& segment : module_->data_segments) {
     uint32_t size = segment.source.length();
 
@@ -1733,8 +1780,16 @@ void InstanceBuilder::LoadDataSegments(
 
     uint8_t* memory_base =
         trusted_instance_data->memory_base(segment.memory_index);
-    std::memcpy(memory_base + dest_offset,
-                wire_bytes.begin() + segment.source.offset(), size);
+    base::Vector<const uint8_t> source = wire_bytes.SubVector(
+        segment.source.offset(), segment.source.end_offset());
+    size_t& memory_initialized_end = initialized_end[segment.memory_index];
+    if (!dst_memory.imported && dest_offset >= memory_initialized_end) {
+      CopyToZeroInitializedMemory(memory_base + dest_offset, source);
+    } else {
+      std::memcpy(memory_base + dest_offset, source.begin(), size);
+    }
+    memory_initialized_end =
+        std::max(memory_initialized_end, dest_offset + size);
   }
 }
 
@@ -65,7 +65,10 @@ class StructTypeBase : public ZoneObject {
     return RoundUp(offset, std::min(alignment, uint32_t{kTaggedSize}));
   }
 
-  void InitializeOffsets() {
+  // Computes the field offsets. Fields with index >= {reorderable_from} may be
+  // laid out in any order; this is only allowed for final types, whose layout
+  // doesn't have to be a prefix of any subtype's layout.
+  void InitializeOffsets(uint32_t reorderable_from = kMaxUInt32) {
     if (field_count() == 0) return;
     DCHECK(!offsets_initialized_);
     uint32_t offset = field(0).value_kind_size();
@@ -76,7 +79,7 @@ class StructTypeBase : public ZoneObject {
     // always compute the same offsets for the fields in this common prefix.
     uint32_t gap_position = 0;
     uint32_t gap_size = 0;
-    for (uint32_t i = 1; i < field_count(); i++) {
+    auto place_field = [&](uint32_t i) {
       uint32_t field_size = field(i).value_kind_size();
       if (field_size <= gap_size) {
         uint32_t aligned_gap = Align(gap_position, field_size);
@@ -92,7 +95,7 @@ class StructTypeBase : public ZoneObject {
             gap_position = aligned_gap + field_size;
             gap_size = gap_after;
           }
-          continue;  // Successfully placed the field in the gap.
+          return;  // Successfully placed the field in the gap.
         }
       }
       uint32_t old_offset = offset;
@@ -104,6 +107,23 @@ class StructTypeBase : public ZoneObject {
       }
       field_offsets_[i - 1] = offset;
       offset += field_size;
+    };
+    // The first field is always at offset 0.
+    uint32_t fixed_count =
+        std::max(uint32_t{1}, std::min(reorderable_from, field_count()));
+    for (uint32_t i = 1; i < fixed_count; i++) place_field(i);
+    // Place the remaining fields by decreasing size, which keeps alignment
+    // padding to a minimum. Sizes are powers of two up to
+    // {kMaxValueTypeSize}, so a few passes over the fields suffice, and the
+    // order among equally-sized fields stays deterministic.
+    if (fixed_count < field_count()) {
+      for (uint32_t size = kMaxValueTypeSize; size > 0; size >>= 1) {
+        for (uint32_t i = fixed_count; i < field_count(); i++) {
+          if (static_cast<uint32_t>(field(i).value_kind_size()) == size) {
+            place_field(i);
+          }
+        }
+      }
     }
     offset = RoundUp(offset, kTaggedSize);
     field_offsets_[field_count() - 1] = offset;
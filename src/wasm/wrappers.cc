@@ -10,6 +10,7 @@
 #include "src/compiler/linkage.h"
 #include "src/compiler/turboshaft/index.h"
 #include "src/compiler/turboshaft/wasm-assembler-helpers.h"
+#include "src/objects/bigint.h"
 #include "src/objects/object-list-macros.h"
 #include "src/wasm/turboshaft-graph-interface.h"
 #include "src/wasm/wasm-engine.h"
@@ -181,13 +182,37 @@ class WasmWrapperTSGraphBuilder : public WasmGraphBuilderBase {
   }
 
   V<Number> BuildChangeFloat32ToNumber(V<Float32> value) {
-    return CallBuiltin<WasmFloat32ToNumberDescriptor>(
-        Builtin::kWasmFloat32ToNumber, Operator::kNoProperties, value);
+    // Every float32 is exactly representable as a float64, so we can share the
+    // inlined Smi fast path of the float64 conversion.
+    return BuildChangeFloat64ToNumber(__ ChangeFloat32ToFloat64(value));
   }
 
   V<Number> BuildChangeFloat64ToNumber(V<Float64> value) {
-    return CallBuiltin<WasmFloat64ToTaggedDescriptor>(
-        Builtin::kWasmFloat64ToNumber, Operator::kNoProperties, value);
+    // Integral results are common for floating-point returns and parameters
+    // (e.g. indices or counters), so the Smi conversion is inlined and only
+    // other values call the builtin to allocate a HeapNumber.
+    Label<Number> done(&Asm());
+    Label<> not_smi(&Asm());
+
+    V<Word32> value32 = __ TruncateFloat64ToInt32OverflowUndefined(value);
+    V<Word32> is_integral =
+        __ Float64Equal(value, __ ChangeInt32ToFloat64(value32));
+    GOTO_IF_NOT(LIKELY(is_integral), not_smi);
+    IF (UNLIKELY(__ Word32Equal(value32, 0))) {
+      // In case of 0, we need to check the high bits for the IEEE -0 pattern.
+      GOTO_IF(__ Int32LessThan(__ Float64ExtractHighWord32(value), 0),
+              not_smi);
+    }
+    GOTO(done, BuildChangeInt32ToNumber(value32));
+
+    if (BIND(not_smi)) {
+      GOTO(done, CallBuiltin<WasmFloat64ToTaggedDescriptor>(
+                     Builtin::kWasmFloat64ToNumber, Operator::kNoProperties,
+                     value));
+    }
+
+    BIND(done, result);
+    return result;
   }
 
   V<Object> ToJS(OpIndex ret, CanonicalValueType type, V<Context> context) {
@@ -866,17 +891,32 @@ class WasmWrapperTSGraphBuilder : public WasmGraphBuilderBase {
   V<Float64> BuildChangeTaggedToFloat64(
       OpIndex value, OpIndex context,
       compiler::turboshaft::OptionalOpIndex frame_state) {
-    OpIndex call = frame_state.valid()
-                       ? CallBuiltin<WasmTaggedToFloat64Descriptor>(
-                             Builtin::kWasmTaggedToFloat64, frame_state.value(),
-                             Operator::kNoProperties, value, context)
-                       : CallBuiltin<WasmTaggedToFloat64Descriptor>(
-                             Builtin::kWasmTaggedToFloat64,
-                             Operator::kNoProperties, value, context);
-    // The source position here is needed for asm.js, see the comment on the
-    // source position of the call to JavaScript in the wasm-to-js wrapper.
-    __ output_graph().source_positions()[call] = SourcePosition(1);
-    return call;
+    // Smis and HeapNumbers are converted inline, only other values (which
+    // need a full ToNumber conversion) call the builtin.
+    ScopedVar<Float64> result(this, OpIndex::Invalid());
+    IF (__ IsSmi(value)) {
+      result = __ ChangeInt32ToFloat64(__ UntagSmi(value));
+    } ELSE {
+      V<Map> map = LoadMap(value);
+      IF (LIKELY(__ TaggedEqual(map, LOAD_ROOT(HeapNumberMap)))) {
+        result = HeapNumberToFloat64(V<HeapNumber>::Cast(value));
+      } ELSE {
+        OpIndex call =
+            frame_state.valid()
+                ? CallBuiltin<WasmTaggedToFloat64Descriptor>(
+                      Builtin::kWasmTaggedToFloat64, frame_state.value(),
+                      Operator::kNoProperties, value, context)
+                : CallBuiltin<WasmTaggedToFloat64Descriptor>(
+                      Builtin::kWasmTaggedToFloat64, Operator::kNoProperties,
+                      value, context);
+        result = call;
+        // The source position here is needed for asm.js, see the comment on
+        // the source position of the call to JavaScript in the wasm-to-js
+        // wrapper.
+        __ output_graph().source_positions()[call] = SourcePosition(1);
+      }
+    }
+    return result;
   }
 
   OpIndex BuildChangeTaggedToInt32(
@@ -912,6 +952,54 @@ class WasmWrapperTSGraphBuilder : public WasmGraphBuilderBase {
   OpIndex BuildChangeBigIntToInt64(
       OpIndex input, OpIndex context,
       compiler::turboshaft::OptionalOpIndex frame_state) {
+    if (Is64()) {
+      // BigInts with at most one digit are by far the most common i64 inputs,
+      // so their truncation to 64 bits is inlined. Everything else (including
+      // non-BigInt values, which need a ToBigInt conversion) goes through the
+      // builtin.
+      ScopedVar<Word64> result(this, OpIndex::Invalid());
+      IF (LIKELY(IsBigIntWithAtMostOneDigit(input))) {
+        V<Word32> bitfield = __ template LoadField<Word32>(
+            input, compiler::AccessBuilder::ForBigIntBitfield());
+        IF (__ Word32Equal(bitfield, 0)) {
+          result = __ Word64Constant(uint64_t{0});
+        } ELSE {
+          V<Word64> digit = __ template LoadField<Word64>(
+              input,
+              compiler::AccessBuilder::ForBigIntLeastSignificantDigit64());
+          V<Word32> sign =
+              __ Word32BitwiseAnd(bitfield, BigInt::SignBits::kMask);
+          IF (__ Word32Equal(sign, BigInt::SignBits::kMask)) {
+            result = __ Word64Sub(0, digit);
+          } ELSE {
+            result = digit;
+          }
+        }
+      } ELSE {
+        result = CallBigIntToInt64Builtin(input, context, frame_state);
+      }
+      return result;
+    }
+    return CallBigIntToInt64Builtin(input, context, frame_state);
+  }
+
+  V<Word32> IsBigIntWithAtMostOneDigit(OpIndex input) {
+    ScopedVar<Word32> result(this, __ Word32Constant(0));
+    IF_NOT (__ IsSmi(input)) {
+      IF (__ TaggedEqual(LoadMap(input), LOAD_ROOT(BigIntMap))) {
+        V<Word32> bitfield = __ template LoadField<Word32>(
+            input, compiler::AccessBuilder::ForBigIntBitfield());
+        result = __ Uint32LessThanOrEqual(
+            __ Word32BitwiseAnd(bitfield, BigInt::LengthBits::kMask),
+            BigInt::LengthBits::encode(1));
+      }
+    }
+    return result;
+  }
+
+  OpIndex CallBigIntToInt64Builtin(
+      OpIndex input, OpIndex context,
+      compiler::turboshaft::OptionalOpIndex frame_state) {
     OpIndex target;
     if (Is64()) {
       target = GetTargetForBuiltinCall(Builtin::kBigIntToI64);